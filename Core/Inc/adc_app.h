@@ -10,14 +10,65 @@
 
 #include <stdint.h>
 
+#define ADC_RATE_DEFAULT_HZ 1000UL
+#define ADC_RATE_MIN_HZ     1UL
+#define ADC_RATE_MAX_HZ     100000UL
+
+#define ADC_NTC_CHANNEL     1    // thermistor divider on PA1 / IN1
+
+// adc_app_ch_add / adc_app_ch_remove results
+#define ADC_CH_ERR_CHANNEL  -1   // not a usable channel / not in sequence
+#define ADC_CH_ERR_SMP      -2   // unsupported sample time
+#define ADC_CH_ERR_FULL     -3   // sequence already has ADC_MAX_CHANNELS
+#define ADC_CH_ERR_RATE     -4   // scan would not fit the current rate
+#define ADC_CH_ERR_EMPTY    -5   // cannot remove the last channel
+#define ADC_CH_ERR_OS       -6   // oversampling exponent out of range
+
+typedef struct {
+    uint64_t count;
+    uint16_t min;
+    uint16_t max;
+    uint16_t last;
+    float    mean;
+    float    var;       // sample variance, LSB^2
+} adc_stats_snapshot_t;
+
 void     adc_app_init(void);
 void     adc_app_start(void);
 void     adc_app_stop(void);
+void     task_adc(void);
+
+int      adc_app_set_rate(uint32_t hz);
+uint32_t adc_app_get_rate(void);
+uint32_t adc_app_get_rate_mhz(void);
+uint32_t adc_app_max_rate(void);
+
+int      adc_app_ch_add(uint8_t ch, uint16_t smp_cycles);
+int      adc_app_ch_remove(uint8_t ch);
+int      adc_app_ch_find(uint8_t ch);
+uint8_t  adc_app_ch_count(void);
+uint8_t  adc_app_ch_num(uint8_t idx);
+uint16_t adc_app_ch_smp_cycles(uint8_t idx);
+
+int      adc_app_os_set(uint8_t ch, uint8_t bits);
+uint8_t  adc_app_os_bits(uint8_t idx);
+uint16_t adc_app_os_latest(uint8_t idx);
+uint32_t adc_app_os_count(uint8_t idx);
+uint32_t adc_app_os_read(uint8_t idx, uint16_t *dst, uint32_t n);
+
+uint16_t adc_app_latest(uint8_t idx);
+uint16_t adc_app_average(uint8_t idx);
+uint16_t adc_app_min(uint8_t idx);
+uint16_t adc_app_max(uint8_t idx);
+void     adc_app_stats_get(uint8_t idx, adc_stats_snapshot_t *out);
+void     adc_app_stats_reset(void);
+uint32_t adc_app_blocks(void);
+uint32_t adc_app_seq_gaps(void);
+uint16_t adc_app_run_id(void);      // increments on every start
+
+uint32_t adc_app_snapshot(uint8_t idx, uint16_t *dst, uint32_t n);
+uint32_t adc_app_snapshot_mean(uint8_t idx, uint32_t n, uint16_t *mean);
 
-uint16_t adc_app_latest(void);
-uint16_t adc_app_average(void);
-uint16_t adc_read_once(void);
-uint16_t adc_read_avg(uint8_t samples);
 uint32_t adc_to_voltage(uint16_t raw);
 
 float adc_to_ntc_resistance(uint16_t raw, float rdiv);
@@ -0,0 +1,41 @@
+/*
+ * adc_conv.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_ADC_CONV_H_
+#define INC_ADC_CONV_H_
+
+#include <stdint.h>
+
+#define ADC_CONV_VREF_MV 3300    // must stay <= 4096 for the exact /4095 path
+
+/*
+ * Linear code -> engineering units:  y = (raw * gain + offset) >> shift
+ * gain is a signed Q(shift) slope kept to 16 bits so the product with a
+ * 12-bit code can't overflow. Set up with adc_conv_init().
+ */
+typedef struct {
+    int16_t gain;
+    uint8_t shift;
+    int32_t offset;
+} adc_conv_t;
+
+typedef struct {
+    uint32_t scalar_x100;       // adc_to_voltage() per sample, cycles x100
+    uint32_t mv_x100;           // adc_conv_mv_block()
+    uint32_t units_x100;        // adc_conv_block()
+    uint32_t mismatches;        // codes where mv_block != adc_to_voltage
+} adc_conv_bench_t;
+
+// exact match for adc_to_voltage() on every 12-bit code
+void adc_conv_mv_block(const uint16_t *raw, uint16_t *mv, uint32_t n);
+
+int  adc_conv_init(adc_conv_t *c, int32_t at_zero, int32_t at_full);
+void adc_conv_block(const adc_conv_t *c, const uint16_t *raw, int16_t *out, uint32_t n);
+
+void adc_conv_bench(adc_conv_bench_t *r);
+
+#endif /* INC_ADC_CONV_H_ */
@@ -0,0 +1,49 @@
+/*
+ * adc_history.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_ADC_HISTORY_H_
+#define INC_ADC_HISTORY_H_
+
+#include <stdint.h>
+
+/*
+ * Round-robin aggregate store, one per sequence rank. Level 0 buckets sit
+ * on a fixed 1 s grid of wall time and every sample lands in the bucket
+ * of its own timestamp, not of the block that carried it. Seconds with no
+ * samples (pauses, slow rates) close as count-0 buckets, so every coarser
+ * level, built by folding a fixed number of closed buckets from the level
+ * below, also spans real time. RAM is fixed at compile time.
+ */
+typedef enum {
+    ADC_HIST_1S = 0,
+    ADC_HIST_10S,
+    ADC_HIST_1M,
+    ADC_HIST_1H,
+    ADC_HIST_LEVELS
+} adc_hist_level_t;
+
+typedef struct {
+    uint64_t sum;
+    uint32_t count;
+    uint16_t min;
+    uint16_t max;
+} adc_hist_bucket_t;
+
+void        adc_history_reset(void);
+// x[n - 1] was taken at end_ms, the others 1/rate_hz apart before it
+void        adc_history_add(uint8_t idx, uint32_t end_ms, const uint16_t *x,
+                            uint32_t n, uint32_t rate_hz);
+
+int         adc_history_level(const char *name);
+const char *adc_history_level_name(uint8_t level);
+uint32_t    adc_history_level_len(uint8_t level);
+
+// age 0 is the newest closed bucket; returns 0 if there is none that old
+int         adc_history_get(uint8_t idx, uint8_t level, uint32_t age,
+                            adc_hist_bucket_t *dst);
+
+#endif /* INC_ADC_HISTORY_H_ */
@@ -0,0 +1,39 @@
+/*
+ * adc_os.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_ADC_OS_H_
+#define INC_ADC_OS_H_
+
+#include <stdint.h>
+
+#define ADC_OS_MAX_BITS 4    // 4^4 = 256x -> 16-bit output
+#define ADC_OS_OUT_LEN  32   // decimated outputs kept per channel (power of two)
+
+#if (ADC_OS_OUT_LEN & (ADC_OS_OUT_LEN - 1)) != 0
+#error "ADC_OS_OUT_LEN must be a power of two"
+#endif
+
+/*
+ * Oversample-and-decimate: sum 4^bits consecutive 12-bit samples and
+ * shift right by bits, giving one (12 + bits)-bit output per 4^bits inputs.
+ * The extra bits are only real if the input carries >= 1 LSB of noise.
+ */
+typedef struct {
+    uint8_t  bits;
+    uint32_t acc;
+    uint32_t cnt;
+    uint32_t produced;                  // total outputs, also the write index
+    uint16_t out[ADC_OS_OUT_LEN];
+} adc_os_t;
+
+void     adc_os_init(adc_os_t *os, uint8_t bits);
+void     adc_os_process(adc_os_t *os, const uint16_t *x, uint32_t n);
+
+uint16_t adc_os_latest(const adc_os_t *os);
+uint32_t adc_os_read(const adc_os_t *os, uint16_t *dst, uint32_t n);
+
+#endif /* INC_ADC_OS_H_ */
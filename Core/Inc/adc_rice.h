@@ -0,0 +1,24 @@
+/*
+ * adc_rice.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_ADC_RICE_H_
+#define INC_ADC_RICE_H_
+
+#include <stdint.h>
+
+/*
+ * Lossless block coder for 12-bit ADC samples (FLAC-style fixed
+ * predictors). Bitstream per channel is specified in adc_stream_proto.h.
+ */
+
+// bytes needed for the worst case (every channel verbatim)
+#define ADC_RICE_MAX_BYTES(nch, n)  ((nch) * (1 + ((n) * 12 + 7) / 8))
+
+// encode one channel; returns bytes written, 0 if cap is too small
+uint32_t adc_rice_encode(const uint16_t *x, uint32_t n, uint8_t *out, uint32_t cap);
+
+#endif /* INC_ADC_RICE_H_ */
@@ -0,0 +1,56 @@
+/*
+ * adc_ring.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_ADC_RING_H_
+#define INC_ADC_RING_H_
+
+#include <stdint.h>
+
+#define ADC_MAX_CHANNELS 8
+#define ADC_BLOCK_FRAMES 32  // scan sequences (triggers) per block
+#define ADC_RING_SLOTS   8   // must be a power of two
+
+#if (ADC_RING_SLOTS & (ADC_RING_SLOTS - 1)) != 0
+#error "ADC_RING_SLOTS must be a power of two"
+#endif
+
+/*
+ * Planar (de-interleaved) block: samples[i] holds ADC_BLOCK_FRAMES
+ * consecutive samples of the channel at sequence rank i, so per-channel
+ * processing runs on unit-stride data.
+ */
+typedef struct {
+    uint32_t seq;                       // producer block counter
+    uint32_t t_us;                      // TIM2 low word when the last frame landed
+    uint8_t  nch;                       // ranks in use
+    uint8_t  chan[ADC_MAX_CHANNELS];    // ADC channel number per rank
+    uint16_t samples[ADC_MAX_CHANNELS][ADC_BLOCK_FRAMES];
+} adc_block_t;
+
+typedef struct {
+    uint32_t produced;
+    uint32_t consumed;
+    uint32_t dropped;
+    uint32_t level;
+} adc_ring_stats_t;
+
+/*
+ * Single producer (DMA2_Stream0 ISR) / single consumer (task_adc).
+ * head is only written by the producer, tail only by the consumer,
+ * so no interrupt masking is needed on either side.
+ */
+void               adc_ring_reset(void);
+
+adc_block_t       *adc_ring_acquire(void);
+void               adc_ring_publish(void);
+
+const adc_block_t *adc_ring_peek(void);
+void               adc_ring_release(void);
+
+void               adc_ring_get_stats(adc_ring_stats_t *st);
+
+#endif /* INC_ADC_RING_H_ */
@@ -0,0 +1,36 @@
+/*
+ * adc_stream.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_ADC_STREAM_H_
+#define INC_ADC_STREAM_H_
+
+#include <stdint.h>
+#include "adc_ring.h"
+
+typedef struct {
+    uint32_t packets;
+    uint32_t dropped;           // TX ring had no room for the whole packet
+    uint32_t bytes;             // wire bytes, framing included
+    uint32_t raw_payload;       // sample bytes before compression
+    uint32_t sent_payload;      // sample bytes actually sent
+    uint32_t enc_cycles;        // Rice encoder time
+    uint32_t enc_samples;
+} adc_stream_stats_t;
+
+void     adc_stream_enable(uint8_t on);
+uint8_t  adc_stream_enabled(void);
+void     adc_stream_hold(uint8_t on);
+void     adc_stream_set_rice(uint8_t on);
+uint8_t  adc_stream_rice(void);
+
+// task_adc context, once per consumed block
+void     adc_stream_block(const adc_block_t *blk);
+
+void     adc_stream_get_stats(adc_stream_stats_t *st);
+uint32_t adc_stream_wire_rate(void);     // bytes/s needed at the current config
+
+#endif /* INC_ADC_STREAM_H_ */
@@ -0,0 +1,81 @@
+/*
+ * adc_stream_proto.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_ADC_STREAM_PROTO_H_
+#define INC_ADC_STREAM_PROTO_H_
+
+/*
+ * Wire format of "adc stream on". Shared with the host tools, so this
+ * header must not depend on HAL or firmware headers.
+ *
+ * Each packet on USART2 is
+ *
+ *     0x00  COBS( header | payload | crc16 )  0x00
+ *
+ * The leading delimiter lets a receiver resync after console text or a
+ * lost byte. All fields are little-endian. The payload is planar:
+ * nch runs of `frames` uint16 samples, in rank order (chan[0] first).
+ * crc16 is CRC-16/CCITT-FALSE over header and payload.
+ *
+ * Frame k of a packet was sampled at (t0 + k) / rate. seq counts blocks
+ * since the acquisition started, so a seq gap means lost blocks; run
+ * changes whenever acquisition restarts (seq and t0 restart at zero).
+ * A rate change mid-run takes effect inside one block, and that block's
+ * timeline is only exact up to the change.
+ */
+
+#include <stdint.h>
+
+#define ADC_STREAM_MAGIC        0xA5
+#define ADC_STREAM_VERSION      1
+#define ADC_STREAM_MAX_CH       8
+
+#define ADC_STREAM_CRC_POLY     0x1021
+#define ADC_STREAM_CRC_INIT     0xFFFF
+
+#define ADC_STREAM_F_RUN_START  0x01    // first packet of a run
+#define ADC_STREAM_F_RICE       0x02    // payload is Rice coded, see below
+
+/*
+ * ADC_STREAM_F_RICE payload: one byte-aligned section per rank, in rank
+ * order. Each starts with a mode byte: bits 7..6 predictor order
+ * (0..2, or 3 = verbatim), bits 3..0 Rice parameter k. Then, MSB first:
+ *
+ *   verbatim:  `frames` samples, 12 bits each
+ *   order p:   p warm-up samples, 12 bits each, then for every further
+ *              sample the residual e = x[i] - pred, zigzag mapped
+ *              (u = e >= 0 ? 2e : -2e - 1) and coded as q = u >> k in
+ *              unary (q ones, one zero) followed by the low k bits.
+ *              q >= ADC_RICE_QMAX is sent as ADC_RICE_QMAX ones and
+ *              u in ADC_RICE_ESC_BITS bits.
+ *
+ *   pred = 0 (p=0),  x[i-1] (p=1),  2*x[i-1] - x[i-2] (p=2)
+ */
+#define ADC_RICE_QMAX           16
+#define ADC_RICE_ESC_BITS       16
+#define ADC_RICE_MODE_VERBATIM  3
+
+typedef struct __attribute__((packed)) {
+    uint8_t  magic;
+    uint8_t  version;
+    uint8_t  nch;
+    uint8_t  flags;
+    uint32_t chan_mask;                 // bit n set: ADC channel n present
+    uint8_t  chan[ADC_STREAM_MAX_CH];   // channel number per rank
+    uint32_t rate_mhz;                  // frame rate, milli-Hz
+    uint32_t seq;
+    uint64_t t0;                        // index of the first frame in the run
+    uint16_t frames;
+    uint16_t run;
+} adc_stream_hdr_t;
+
+#define ADC_STREAM_HDR_SIZE     36
+
+typedef char adc_stream_hdr_size_check[
+    (sizeof(adc_stream_hdr_t) == ADC_STREAM_HDR_SIZE) ? 1 : -1];
+
+#endif /* INC_ADC_STREAM_PROTO_H_ */
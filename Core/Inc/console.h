@@ -12,11 +12,68 @@
 extern "C" {
 #endif
 
+#include <stdint.h>
+
+// what a writer does when the TX ring cannot take the whole message
+typedef enum {
+	CONSOLE_TX_BLOCK = 0,	// wait for the DMA to drain (default)
+	CONSOLE_TX_DROP,		// discard the whole message
+	CONSOLE_TX_TRUNC,		// queue what fits, discard the rest
+} console_tx_policy_t;
+
+typedef struct {
+	uint32_t bytes_queued;
+	uint32_t bytes_sent;
+	uint32_t dma_xfers;
+	uint32_t blocked;			// writes that had to wait for space
+	uint32_t dropped_msgs;
+	uint32_t dropped_bytes;
+	uint32_t truncated_bytes;
+	uint32_t high_water;
+	uint32_t flushes;			// staged runs handed to the DMA
+	uint32_t early_flushes;		// forced by the size threshold mid-tick
+	uint32_t flush_bytes;
+	uint32_t flush_max;
+	uint32_t level;				// bytes waiting right now
+} console_tx_stats_t;
+
+typedef struct {
+	uint32_t bytes;
+	uint32_t lines;
+	uint32_t overruns;			// DMA lapped the reader
+	uint32_t lost_bytes;
+	uint32_t long_lines;		// rejected, longer than the line buffer
+	uint32_t high_water;		// most unread bytes seen by task_console
+	uint32_t ore;				// USART flags sampled at IDLE
+	uint32_t fe;
+	uint32_t ne;
+} console_rx_stats_t;
+
+/* one command-line token; points into the line buffer, NUL-terminated */
+typedef struct {
+	const char *p;
+	uint8_t len;
+} console_arg_t;
+
 void console_init(void);
 void task_console(void);
+void console_uart_irq(void);	// from USART2_IRQHandler
 
 void console_printf(const char *fmt, ...);
 
+// largest a + b accepted by console_write_frame (CRC included)
+#define CONSOLE_FRAME_MAX 600
+
+// queue one COBS/CRC16 frame; returns wire bytes, or -1 if it didn't fit
+int console_write_frame(const void *a, uint16_t alen, const void *b, uint16_t blen);
+
+void console_set_tx_policy(console_tx_policy_t p);
+console_tx_policy_t console_get_tx_policy(void);
+void console_get_tx_stats(console_tx_stats_t *out);
+void console_reset_tx_stats(void);
+void console_get_rx_stats(console_rx_stats_t *out);
+void console_reset_rx_stats(void);
+
 #ifdef __cplusplus
 }
 #endif
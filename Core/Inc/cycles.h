@@ -0,0 +1,26 @@
+/*
+ * cycles.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_CYCLES_H_
+#define INC_CYCLES_H_
+
+#include "main.h"
+
+// DWT cycle counter (84 MHz core clock); wraps every ~51 s
+static inline void cycles_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t cycles_now(void)
+{
+    return DWT->CYCCNT;
+}
+
+#endif /* INC_CYCLES_H_ */
@@ -0,0 +1,43 @@
+/*
+ * defer.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_DEFER_H_
+#define INC_DEFER_H_
+
+#include <stdint.h>
+
+/*
+ * Deferred work: an ISR posts a function and a 32-bit argument, and
+ * task_defer runs it later in thread context, so the handler only has to
+ * capture what it saw and return. Any number of ISRs may post (they nest
+ * by priority); only the main loop takes items off.
+ *
+ * A post claims a slot by bumping head with LDREX/STREX, fills it, then
+ * publishes it through the slot's sequence number. When the queue is
+ * full the post fails and is counted; nothing ever waits.
+ */
+#define DEFER_SLOTS 16u                 // power of two
+#define DEFER_MASK  (DEFER_SLOTS - 1u)
+
+typedef void (*defer_fn_t)(uint32_t arg);
+
+typedef struct {
+    uint32_t posted;
+    uint32_t run;
+    uint32_t overflows;                 // posts refused, queue full
+    uint32_t high_water;                // most items queued at once
+} defer_stats_t;
+
+int defer_post(defer_fn_t fn, uint32_t arg);    // ISR-safe; 0 or -1 when full
+uint32_t defer_run(void);                       // main loop only; returns items run
+
+void task_defer(void);
+
+void defer_get_stats(defer_stats_t *st);
+void defer_reset_stats(void);
+
+#endif /* INC_DEFER_H_ */
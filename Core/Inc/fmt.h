@@ -0,0 +1,45 @@
+/*
+ * fmt.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_FMT_H_
+#define INC_FMT_H_
+
+#include <stdarg.h>
+#include <stdint.h>
+
+/*
+ * printf subset without libc: %d %i %u %x %X %c %s %% with '-', '0',
+ * width, precision (strings) and l/ll/h/z length modifiers, plus
+ *
+ *   %.<n>q   signed fixed point: the argument is value * 10^n, so
+ *            ("%.2q", -1234) prints "-12.34". Takes ll for 64-bit.
+ *
+ * Output goes to a sink in runs (literal text, one number, padding),
+ * never through a heap or an intermediate line buffer.
+ */
+typedef struct fmt_sink fmt_sink_t;
+
+struct fmt_sink {
+    void (*put)(fmt_sink_t *s, const char *p, uint32_t n);
+};
+
+void fmt_vprint(fmt_sink_t *s, const char *fmt, va_list ap);
+void fmt_print(fmt_sink_t *s, const char *fmt, ...);
+
+// always NUL-terminates; returns the untruncated length
+uint32_t fmt_snprintf(char *buf, uint32_t size, const char *fmt, ...);
+uint32_t fmt_vsnprintf(char *buf, uint32_t size, const char *fmt, va_list ap);
+
+typedef struct {
+    uint32_t fmt_cycles;        // cycles per line through fmt_snprintf
+    uint32_t libc_cycles;       // same line via vsnprintf, 0 unless FMT_BENCH_LIBC
+    uint32_t line_len;
+} fmt_bench_t;
+
+void fmt_bench(fmt_bench_t *r);
+
+#endif /* INC_FMT_H_ */
@@ -43,6 +43,45 @@ typedef enum
     LED_MODE_FAST
 } led_mode_t;
 
+/*
+ * Scheduler tasks; the id is also the bit in the ready mask and the
+ * priority among activated tasks, lowest first.
+ */
+typedef enum
+{
+    TASK_ID_ADC = 0,
+    TASK_ID_DEFER,
+    TASK_ID_CONSOLE,
+    TASK_ID_BUTTON,
+    TASK_ID_LED,
+    TASK_ID_IDLE,
+    TASK_COUNT
+} task_id_t;
+
+/* per-task scheduler profile; run times in core cycles, lateness in us */
+typedef struct
+{
+    const char *name;
+    uint32_t period_ms;         // 0: only when activated
+    uint32_t calls;
+    uint64_t total_cyc;
+    uint32_t min_cyc;
+    uint32_t max_cyc;
+    uint32_t last_cyc;
+    uint32_t timed;             // runs started from a due time
+    int32_t late_min_us;        // start vs due time, timed runs only
+    int32_t late_max_us;
+    int64_t late_sum_us;
+} task_stats_t;
+
+typedef struct
+{
+    uint32_t passes;            // trips round the main loop
+    uint32_t wakeups;           // returns from WFI
+    uint32_t activations;       // tasks run because their ready bit was set
+    uint64_t sleep_us;
+} sched_stats_t;
+
 /* USER CODE END ET */
 
 /* Exported constants --------------------------------------------------------*/
@@ -63,6 +102,14 @@ void led_set_mode(led_mode_t mode);
 led_mode_t led_get_mode(void);
 uint32_t system_uptime_ms(void);
 const char *led_mode_str(led_mode_t mode);
+void task_activate(task_id_t id);        // ISR-safe
+void task_wake_in(task_id_t id, uint32_t us);  // one-shot; main loop only
+void task_wake_cancel(task_id_t id);
+uint8_t task_count(void);
+const task_stats_t *task_get_stats(uint8_t i);
+uint64_t task_stats_window(void);       // us since the last reset
+void task_reset_stats(void);
+void sched_get_stats(sched_stats_t *st);
 
 /* USER CODE END EFP */
 
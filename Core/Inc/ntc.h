@@ -0,0 +1,46 @@
+/*
+ * ntc.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_NTC_H_
+#define INC_NTC_H_
+
+#include <stdint.h>
+
+/*
+ * Thermistor divider on PA1:  3.3 V --[R_PULLUP]--+-- PA1 --[NTC]-- GND
+ *
+ * tools/gen_ntc_table.py reads these values to regenerate ntc_table.c.
+ * The Debug build reruns it when this file changes (makefile.targets);
+ * "make ntc-table-check" fails if the committed table is stale.
+ */
+#define NTC_R_PULLUP_OHM  10000
+#define NTC_R0_OHM        2200      // 2.2k @ 25C
+#define NTC_BETA          3950
+#define NTC_T0_C          25
+
+#define NTC_ADC_CODES     4096
+#define NTC_INVALID       INT16_MIN // code 0 / 4095: open or shorted divider
+
+// centi-degrees C per 12-bit ADC code, clamped to the int16 range
+extern const int16_t ntc_table[NTC_ADC_CODES];
+
+static inline int16_t ntc_code_to_centi_c(uint16_t raw)
+{
+    return ntc_table[raw & (NTC_ADC_CODES - 1)];
+}
+
+typedef struct {
+    int32_t  max_err_cc;        // worst |LUT - float reference|, centi-degrees
+    uint16_t worst_code;
+    uint32_t cycles_x100;       // block conversion cost per sample, x100
+} ntc_report_t;
+
+void     ntc_convert_block(const uint16_t *raw, int16_t *out, uint32_t n);
+uint32_t ntc_code_to_ohms(uint16_t raw);
+void     ntc_check(ntc_report_t *rep);
+
+#endif /* INC_NTC_H_ */
@@ -0,0 +1,52 @@
+/*
+ * timebase.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_TIMEBASE_H_
+#define INC_TIMEBASE_H_
+
+#include "main.h"
+
+/*
+ * Wall time is TIM2, a free-running 32-bit counter at 1 MHz, extended to
+ * 64 bits in software. It keeps counting in sleep, so there is no periodic
+ * tick: CC1 is programmed as a one-shot wakeup for the next deadline, and
+ * SysTick is stopped once this is running (HAL_GetTick reads TIM2 too).
+ *
+ * Cycle time is DWT CYCCNT, also extended to 64 bits. It stops while the
+ * core sleeps, so use it for run time, not for wall time.
+ *
+ * Both extensions rely on being sampled at least once per wrap (71 min
+ * and ~51 s of awake time); timebase_sleep_until never sleeps longer than
+ * TIMEBASE_MAX_SLEEP_US and samples both first.
+ */
+#define TIMEBASE_TIMER_HZ     1000000u
+#define TIMEBASE_MAX_SLEEP_US 1000000u
+
+void timebase_init(void);                   // after MX_TIM2_Init
+
+// low word of the wall time; wraps every ~71 min, compare with (int32_t)(a - b)
+static inline uint32_t timebase_now_us(void)
+{
+    return TIM2->CNT;
+}
+
+uint64_t system_uptime_us(void);
+uint64_t timebase_cycles(void);             // core cycles since timebase_init
+uint32_t timebase_cycles_per_us(void);
+
+static inline uint32_t timebase_cycles_to_us(uint32_t cycles)
+{
+    return cycles / timebase_cycles_per_us();
+}
+
+/*
+ * Sleep until wake_us (a timebase_now_us value) or any interrupt; returns
+ * us slept. A nonzero *ready, checked with interrupts masked, cancels it.
+ */
+uint32_t timebase_sleep_until(uint32_t wake_us, const volatile uint32_t *ready);
+
+#endif /* INC_TIMEBASE_H_ */
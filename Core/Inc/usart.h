@@ -35,13 +35,15 @@ extern "C" {
 extern UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN Private defines */
-
+#define USART_BAUD_DEFAULT 115200UL
+#define USART_BAUD_MIN     1200UL
 /* USER CODE END Private defines */
 
 void MX_USART2_UART_Init(void);
 
 /* USER CODE BEGIN Prototypes */
-
+uint32_t usart2_baud_plan(uint32_t baud, uint32_t *brr, uint8_t *over8);
+int usart2_set_baud(uint32_t baud);
 /* USER CODE END Prototypes */
 
 #ifdef __cplusplus
@@ -0,0 +1,39 @@
+/*
+ * watch.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: matkins
+ */
+
+#ifndef INC_WATCH_H_
+#define INC_WATCH_H_
+
+#include <stdint.h>
+
+#define WATCH_SLOTS          8
+#define WATCH_MIN_PERIOD_MS  10     // each line costs a console wakeup
+#define WATCH_MAX_PERIOD_MS  3600000UL
+
+#define WATCH_ERR_METRIC    -1
+#define WATCH_ERR_PERIOD    -2
+#define WATCH_ERR_FULL      -3
+
+/*
+ * Periodic push of console metrics. Each due subscription prints one
+ * line "@<metric> <uptime ms> <fields>" through console_printf, so a host
+ * gets a steady stream without a request per sample.
+ */
+int      watch_add(const char *metric, uint32_t period_ms);    // adds or re-times
+uint8_t  watch_remove(const char *metric);                     // NULL: all; returns removed
+void     watch_poll(uint32_t now_ms);
+int      watch_next_due(uint32_t *due_ms);                     // 0 and the earliest, -1 if none
+
+uint8_t     watch_count(void);
+const char *watch_name(uint8_t i);
+uint32_t    watch_period(uint8_t i);
+uint32_t    watch_late(uint8_t i);          // periods skipped because we fell behind
+
+uint8_t     watch_metric_count(void);
+const char *watch_metric_name(uint8_t i);
+
+#endif /* INC_WATCH_H_ */
@@ -1,20 +1,175 @@
 #include "adc_app.h"
 #include "adc.h"
+#include "adc_history.h"
+#include "adc_os.h"
+#include "adc_ring.h"
+#include "adc_stream.h"
+#include "ntc.h"
+#include "tim.h"
+#include "timebase.h"
 #include <string.h>
-#include <stdio.h>
 
 #include <math.h>    // for logf
 
 #include "console.h"
 
-#define ADC_DMA_BUF_LEN 32
+#define ADC_DMA_BUF_LEN (2 * ADC_BLOCK_FRAMES * ADC_MAX_CHANNELS)
+
+#define ADC_CH_NUM_MAX  19   // IN0..IN18
+
+// ADCCLK = PCLK2 / 4 (hadc1.Init.ClockPrescaler); 12 cycles of SAR conversion
+#define ADC_CONV_CYCLES 12u
+
+typedef struct {
+    uint16_t last;
+    uint16_t min;
+    uint16_t max;
+    uint16_t avg;
+} adc_ch_result_t;
+
+typedef struct {
+    uint64_t n;
+    double   mean;
+    double   m2;        // sum of squared deviations from the mean
+    uint16_t min;
+    uint16_t max;
+    uint16_t last;
+} adc_stats_t;
+
+typedef struct {
+    uint8_t  ch;        // ADC channel number (0..15, 17, 18)
+    uint8_t  smp;       // index into adc_smp_cycles[]
+} adc_seq_entry_t;
+
+typedef struct {
+    GPIO_TypeDef *port;
+    uint16_t      pin;
+} adc_pin_t;
+
+// Sample time options, in ADC_SAMPLETIME_xCYCLES order
+static const uint16_t adc_smp_cycles[] = { 3, 15, 28, 56, 84, 112, 144, 480 };
+
+#define ADC_SMP_COUNT (sizeof(adc_smp_cycles) / sizeof(adc_smp_cycles[0]))
+
+// External inputs on ADC1 IN0..IN15. NULL port = not available on this board
+// (PA2/PA3 carry USART2, PA5 drives LD2).
+static const adc_pin_t adc_pins[16] =
+{
+    { GPIOA, GPIO_PIN_0 }, { GPIOA, GPIO_PIN_1 }, { NULL, 0 },
+    { NULL, 0 },           { GPIOA, GPIO_PIN_4 }, { NULL, 0 },
+    { GPIOA, GPIO_PIN_6 }, { GPIOA, GPIO_PIN_7 }, { GPIOB, GPIO_PIN_0 },
+    { GPIOB, GPIO_PIN_1 }, { GPIOC, GPIO_PIN_0 }, { GPIOC, GPIO_PIN_1 },
+    { GPIOC, GPIO_PIN_2 }, { GPIOC, GPIO_PIN_3 }, { GPIOC, GPIO_PIN_4 },
+    { GPIOC, GPIO_PIN_5 },
+};
 
 static uint16_t adc_dma_buf[ADC_DMA_BUF_LEN];
 static uint8_t  adc_running = 0;
+static uint32_t adc_rate_hz = ADC_RATE_DEFAULT_HZ;
+static uint32_t adc_next_seq = 0;
+static uint16_t adc_run_id = 0;
+
+// DMA halves completed since start; lets the snapshot reader know how much
+// of adc_dma_buf holds real samples before the first wrap
+static volatile uint32_t adc_dma_halves = 0;
+
+// Regular sequence; only changed while stopped
+static adc_seq_entry_t adc_seq[ADC_MAX_CHANNELS] = { { 1, 4 } };   // IN1 @ 84 cycles
+static uint8_t         adc_nch = 1;
+
+// Oversampling: config is kept per channel number so it survives sequence
+// edits; decimator state is per rank and rebuilt on start
+static uint8_t  adc_os_cfg[ADC_CH_NUM_MAX];
+static adc_os_t adc_os[ADC_MAX_CHANNELS];
+
+static adc_ch_result_t adc_result[ADC_MAX_CHANNELS];
+
+// Full-history statistics per channel number. Updated by task_adc and read
+// by the console, both from the main loop, so every read is consistent.
+static adc_stats_t     adc_stats[ADC_CH_NUM_MAX];
+static uint32_t        adc_result_blocks;
+static uint32_t        adc_result_seq_gaps;
+
+// TIM3 sits on APB1; timer clocks run at 2x PCLK1 whenever APB1 is divided
+static uint32_t adc_trig_clock_hz(void)
+{
+    uint32_t pclk1 = HAL_RCC_GetPCLK1Freq();
+
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+        pclk1 *= 2;
+
+    return pclk1;
+}
+
+static uint32_t adc_clock_hz(void)
+{
+    return HAL_RCC_GetPCLK2Freq() / 4;
+}
+
+static uint32_t adc_hal_channel(uint8_t ch)
+{
+    if (ch == 18)
+        return ADC_CHANNEL_TEMPSENSOR;
+
+    return ch;   // ADC_CHANNEL_0..17 are the channel numbers themselves
+}
+
+static int adc_channel_valid(uint8_t ch)
+{
+    if (ch < 16)
+        return adc_pins[ch].port != NULL;
+
+    return ch == 17 || ch == 18;   // VREFINT, temperature sensor
+}
+
+static void adc_channel_gpio_init(uint8_t ch)
+{
+    if (ch >= 16)
+        return;
+
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    GPIO_InitStruct.Pin  = adc_pins[ch].pin;
+    GPIO_InitStruct.Mode = GPIO_MODE_ANALOG;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    HAL_GPIO_Init(adc_pins[ch].port, &GPIO_InitStruct);
+}
+
+// ADC clocks needed for one full scan of the sequence
+static uint32_t adc_frame_cycles(const adc_seq_entry_t *seq, uint8_t nch)
+{
+    uint32_t cycles = 0;
+
+    for (uint8_t i = 0; i < nch; i++)
+        cycles += adc_smp_cycles[seq[i].smp] + ADC_CONV_CYCLES;
+
+    return cycles;
+}
+
+static void adc_apply_sequence(void)
+{
+    ADC_ChannelConfTypeDef sConfig = {0};
+
+    hadc1.Init.ScanConvMode    = ENABLE;
+    hadc1.Init.NbrOfConversion = adc_nch;
+    if (HAL_ADC_Init(&hadc1) != HAL_OK)
+        Error_Handler();
+
+    for (uint8_t i = 0; i < adc_nch; i++) {
+        adc_channel_gpio_init(adc_seq[i].ch);
+
+        sConfig.Channel      = adc_hal_channel(adc_seq[i].ch);
+        sConfig.Rank         = i + 1;
+        sConfig.SamplingTime = adc_seq[i].smp;   // ADC_SAMPLETIME_xCYCLES == index
+        if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+            Error_Handler();
+    }
+}
 
 void adc_app_init(void)
 {
-    // Nothing required yet
+    adc_apply_sequence();
+    adc_app_set_rate(ADC_RATE_DEFAULT_HZ);
 }
 
 void adc_app_start(void)
@@ -22,12 +177,28 @@ void adc_app_start(void)
     if (adc_running)
         return;
 
+    adc_ring_reset();
+    adc_next_seq = 0;
+    adc_run_id++;
+    adc_dma_halves = 0;
+    memset(adc_result, 0, sizeof(adc_result));
+    adc_result_blocks   = 0;
+    adc_result_seq_gaps = 0;
+
+    for (uint8_t i = 0; i < adc_nch; i++)
+        adc_os_init(&adc_os[i], adc_os_cfg[adc_seq[i].ch]);
+
+    // DMA length is whole scan frames, so each half holds exactly
+    // ADC_BLOCK_FRAMES complete sequences
     HAL_ADC_Start_DMA(
         &hadc1,
         (uint32_t *)adc_dma_buf,
-        ADC_DMA_BUF_LEN
+        2 * ADC_BLOCK_FRAMES * adc_nch
     );
 
+    // Each TIM3 update (TRGO) starts exactly one conversion
+    HAL_TIM_Base_Start(&htim3);
+
     adc_running = 1;
 }
 
@@ -36,54 +207,468 @@ void adc_app_stop(void)
     if (!adc_running)
         return;
 
+    HAL_TIM_Base_Stop(&htim3);
     HAL_ADC_Stop_DMA(&hadc1);
     adc_running = 0;
 }
 
-uint16_t adc_app_latest(void)
+uint32_t adc_app_max_rate(void)
+{
+    uint32_t hz = adc_clock_hz() / adc_frame_cycles(adc_seq, adc_nch);
+
+    return hz < ADC_RATE_MAX_HZ ? hz : ADC_RATE_MAX_HZ;
+}
+
+int adc_app_set_rate(uint32_t hz)
 {
+    if (hz < ADC_RATE_MIN_HZ || hz > adc_app_max_rate())
+        return -1;
+
+    uint32_t clk   = adc_trig_clock_hz();
+    uint32_t ticks = (clk + hz / 2) / hz;
+
+    // Smallest prescaler that lets the period fit the 16-bit ARR,
+    // which keeps the period resolution (and rate accuracy) as fine as possible
+    uint32_t psc = (ticks + 0xFFFFu) / 0x10000u;
+    if (psc == 0)
+        psc = 1;
+
+    uint32_t arr = (clk / psc + hz / 2) / hz;
+    if (arr < 2)
+        arr = 2;
+    if (arr > 0x10000u)
+        arr = 0x10000u;
+
+    htim3.Init.Prescaler = psc - 1;
+    htim3.Init.Period    = arr - 1;
+
+    __HAL_TIM_SET_PRESCALER(&htim3, psc - 1);
+    __HAL_TIM_SET_AUTORELOAD(&htim3, arr - 1);
+
+    // While sampling, the preloaded values take effect at the next update
+    // so the stream never sees a short period or an extra trigger.
+    // When idle, force the load now; the ADC is off and ignores the TRGO.
     if (!adc_running)
+        htim3.Instance->EGR = TIM_EGR_UG;
+
+    adc_rate_hz = hz;
+    return 0;
+}
+
+uint32_t adc_app_get_rate(void)
+{
+    return adc_rate_hz;
+}
+
+uint32_t adc_app_get_rate_mhz(void)
+{
+    uint32_t psc = htim3.Init.Prescaler + 1;
+    uint32_t arr = htim3.Init.Period + 1;
+
+    return (uint32_t)(((uint64_t)adc_trig_clock_hz() * 1000u) / (psc * arr));
+}
+
+/*
+ * Fold one block into the full-history statistics. The block's own sum and
+ * centred M2 are exact integers; they are merged with the running totals
+ * using the pairwise (Chan et al.) form of Welford's update, so the cost is
+ * a few 64-bit operations per block and no per-sample divides.
+ */
+static void adc_stats_merge(adc_stats_t *st, uint32_t sum, uint64_t sumsq,
+                            uint16_t min, uint16_t max, uint16_t last)
+{
+    const uint32_t nb = ADC_BLOCK_FRAMES;
+
+    // n*sumsq - sum^2 <= 32 * 32 * 4095^2, well inside 64 bits
+    double m2_b   = (double)((uint64_t)nb * sumsq - (uint64_t)sum * sum) / nb;
+    double mean_b = (double)sum / nb;
+
+    uint64_t na = st->n;
+    uint64_t n  = na + nb;
+    double delta = mean_b - st->mean;
+
+    st->mean += delta * nb / n;
+    st->m2   += m2_b + delta * delta * ((double)na * nb / n);
+    st->n     = n;
+
+    if (na == 0 || min < st->min) st->min = min;
+    if (na == 0 || max > st->max) st->max = max;
+    st->last = last;
+}
+
+static void adc_process_channel(uint8_t idx, adc_stats_t *st,
+                                const uint16_t *x, uint32_t end_ms)
+{
+    adc_ch_result_t *res = &adc_result[idx];
+    uint32_t sum = 0;
+    uint64_t sumsq = 0;
+    uint16_t min = 0xFFFF;
+    uint16_t max = 0;
+
+    for (uint32_t i = 0; i < ADC_BLOCK_FRAMES; i++) {
+        uint16_t v = x[i];
+
+        sum += v;
+        sumsq += (uint32_t)v * v;
+        if (v < min) min = v;
+        if (v > max) max = v;
+    }
+
+    res->last = x[ADC_BLOCK_FRAMES - 1];
+    res->min  = min;
+    res->max  = max;
+    res->avg  = (uint16_t)(sum / ADC_BLOCK_FRAMES);
+
+    adc_stats_merge(st, sum, sumsq, min, max, res->last);
+    adc_history_add(idx, end_ms, x, ADC_BLOCK_FRAMES, adc_rate_hz);
+}
+
+void task_adc(void)
+{
+    const adc_block_t *blk;
+    uint64_t now_us = system_uptime_us();
+
+    while ((blk = adc_ring_peek()) != NULL) {
+        // A jump in seq means the producer dropped blocks while we were late
+        if (blk->seq != adc_next_seq)
+            adc_result_seq_gaps++;
+
+        adc_next_seq = blk->seq + 1;
+
+        // Extend the ISR's low-word stamp; blocks are far younger than a wrap
+        uint32_t age = (uint32_t)now_us - blk->t_us;
+        uint32_t end_ms = (uint32_t)((now_us - age) / 1000u);
+
+        for (uint8_t i = 0; i < blk->nch; i++) {
+            adc_process_channel(i, &adc_stats[blk->chan[i]],
+                                blk->samples[i], end_ms);
+            adc_os_process(&adc_os[i], blk->samples[i], ADC_BLOCK_FRAMES);
+        }
+
+        adc_stream_block(blk);
+
+        adc_result_blocks++;
+        adc_ring_release();
+    }
+}
+
+// ISR context: de-interleave the half DMA just finished into a ring slot.
+// The copy completes long before DMA comes back around to this half.
+static void adc_publish_half(const uint16_t *half)
+{
+    adc_dma_halves++;
+
+    adc_block_t *blk = adc_ring_acquire();
+
+    task_activate(TASK_ID_ADC);     // full ring too: it needs draining
+
+    if (blk == NULL)
+        return;
+
+    uint8_t nch = adc_nch;
+
+    blk->t_us = timebase_now_us();
+    blk->nch = nch;
+    for (uint8_t c = 0; c < nch; c++) {
+        const uint16_t *src = &half[c];
+        uint16_t *dst = blk->samples[c];
+
+        blk->chan[c] = adc_seq[c].ch;
+        for (uint32_t f = 0; f < ADC_BLOCK_FRAMES; f++) {
+            dst[f] = *src;
+            src += nch;
+        }
+    }
+
+    adc_ring_publish();
+}
+
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    if (hadc->Instance == ADC1)
+        adc_publish_half(&adc_dma_buf[0]);
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    if (hadc->Instance == ADC1)
+        adc_publish_half(&adc_dma_buf[ADC_BLOCK_FRAMES * adc_nch]);
+}
+
+/*
+ * Sequence configuration. The ADC has to be stopped to rewrite SQRx
+ * without misaligning the interleaved DMA frames, so a running
+ * acquisition is restarted around the change. Callers build the new
+ * sequence in a local copy; adc_seq/adc_nch are only written here,
+ * after the DMA (and with it the ISR that reads them) has stopped.
+ */
+static void adc_reconfigure(const adc_seq_entry_t *seq, uint8_t nch)
+{
+    uint8_t was_running = adc_running;
+
+    adc_app_stop();
+
+    memcpy(adc_seq, seq, sizeof(adc_seq));
+    adc_nch = nch;
+    adc_apply_sequence();
+
+    // History is kept per rank; ranks now mean different channels
+    adc_history_reset();
+
+    if (was_running)
+        adc_app_start();
+}
+
+int adc_app_ch_find(uint8_t ch)
+{
+    for (uint8_t i = 0; i < adc_nch; i++) {
+        if (adc_seq[i].ch == ch)
+            return i;
+    }
+    return -1;
+}
+
+int adc_app_ch_add(uint8_t ch, uint16_t smp_cycles)
+{
+    uint8_t smp;
+
+    if (!adc_channel_valid(ch))
+        return ADC_CH_ERR_CHANNEL;
+
+    for (smp = 0; smp < ADC_SMP_COUNT; smp++) {
+        if (adc_smp_cycles[smp] == smp_cycles)
+            break;
+    }
+    if (smp == ADC_SMP_COUNT)
+        return ADC_CH_ERR_SMP;
+
+    adc_seq_entry_t seq[ADC_MAX_CHANNELS];
+    uint8_t nch = adc_nch;
+    int idx = adc_app_ch_find(ch);
+
+    memcpy(seq, adc_seq, sizeof(seq));
+
+    if (idx < 0) {
+        if (nch >= ADC_MAX_CHANNELS)
+            return ADC_CH_ERR_FULL;
+        idx = nch++;
+    }
+
+    seq[idx].ch  = ch;
+    seq[idx].smp = smp;
+
+    // The longer scan must still fit inside one trigger period
+    if (adc_clock_hz() / adc_frame_cycles(seq, nch) < adc_rate_hz)
+        return ADC_CH_ERR_RATE;
+
+    adc_reconfigure(seq, nch);
+
+    return 0;
+}
+
+int adc_app_ch_remove(uint8_t ch)
+{
+    int idx = adc_app_ch_find(ch);
+
+    if (idx < 0)
+        return ADC_CH_ERR_CHANNEL;
+
+    if (adc_nch == 1)
+        return ADC_CH_ERR_EMPTY;
+
+    adc_seq_entry_t seq[ADC_MAX_CHANNELS];
+    uint8_t nch = adc_nch;
+
+    memcpy(seq, adc_seq, sizeof(seq));
+    for (uint8_t i = idx; i + 1 < nch; i++)
+        seq[i] = seq[i + 1];
+    nch--;
+
+    adc_reconfigure(seq, nch);
+
+    return 0;
+}
+
+int adc_app_os_set(uint8_t ch, uint8_t bits)
+{
+    if (ch >= ADC_CH_NUM_MAX || !adc_channel_valid(ch))
+        return ADC_CH_ERR_CHANNEL;
+
+    if (bits > ADC_OS_MAX_BITS)
+        return ADC_CH_ERR_OS;
+
+    adc_os_cfg[ch] = bits;
+
+    // Same (main loop) context as task_adc, so the rank can be reset in place
+    int idx = adc_app_ch_find(ch);
+    if (idx >= 0)
+        adc_os_init(&adc_os[idx], bits);
+
+    return 0;
+}
+
+uint8_t adc_app_os_bits(uint8_t idx)
+{
+    return adc_os_cfg[adc_seq[idx].ch];
+}
+
+uint16_t adc_app_os_latest(uint8_t idx)
+{
+    if (!adc_running || idx >= adc_nch)
         return 0;
 
-    // DMA is circular; most recent sample is "last written"
-    uint32_t idx =
-        ADC_DMA_BUF_LEN - __HAL_DMA_GET_COUNTER(hadc1.DMA_Handle);
+    return adc_os_latest(&adc_os[idx]);
+}
 
-    if (idx >= ADC_DMA_BUF_LEN)
-        idx = 0;
+uint32_t adc_app_os_count(uint8_t idx)
+{
+    if (idx >= adc_nch)
+        return 0;
 
-    return adc_dma_buf[idx];
+    return adc_os[idx].produced;
 }
 
-uint16_t adc_app_average(void)
+uint32_t adc_app_os_read(uint8_t idx, uint16_t *dst, uint32_t n)
 {
-    if (!adc_running)
+    if (idx >= adc_nch)
         return 0;
 
-    uint32_t sum = 0;
+    return adc_os_read(&adc_os[idx], dst, n);
+}
 
-    for (int i = 0; i < ADC_DMA_BUF_LEN; i++)
-        sum += adc_dma_buf[i];
+uint8_t adc_app_ch_count(void)
+{
+    return adc_nch;
+}
 
-    return (uint16_t)(sum / ADC_DMA_BUF_LEN);
+uint8_t adc_app_ch_num(uint8_t idx)
+{
+    return adc_seq[idx].ch;
 }
 
-uint16_t adc_read_once(void)
+uint16_t adc_app_ch_smp_cycles(uint8_t idx)
 {
-    HAL_ADC_Start(&hadc1);
-    HAL_ADC_PollForConversion(&hadc1, 10);
-    uint16_t v = HAL_ADC_GetValue(&hadc1);
-    HAL_ADC_Stop(&hadc1);
-    return v;
+    return adc_smp_cycles[adc_seq[idx].smp];
 }
 
-uint16_t adc_read_avg(uint8_t samples)
+uint16_t adc_app_latest(uint8_t idx)
 {
-    uint32_t sum = 0;
-    for (uint8_t i = 0; i < samples; i++) {
-        sum += adc_read_once();
+    if (!adc_running || idx >= adc_nch)
+        return 0;
+
+    return adc_result[idx].last;
+}
+
+uint16_t adc_app_average(uint8_t idx)
+{
+    if (!adc_running || idx >= adc_nch)
+        return 0;
+
+    return adc_result[idx].avg;
+}
+
+uint16_t adc_app_min(uint8_t idx)
+{
+    if (!adc_running || idx >= adc_nch)
+        return 0;
+
+    return adc_result[idx].min;
+}
+
+uint16_t adc_app_max(uint8_t idx)
+{
+    if (!adc_running || idx >= adc_nch)
+        return 0;
+
+    return adc_result[idx].max;
+}
+
+void adc_app_stats_get(uint8_t idx, adc_stats_snapshot_t *out)
+{
+    const adc_stats_t *st = &adc_stats[adc_seq[idx].ch];
+
+    out->count = st->n;
+    out->min   = st->min;
+    out->max   = st->max;
+    out->last  = st->last;
+    out->mean  = (float)st->mean;
+    out->var   = st->n > 1 ? (float)(st->m2 / (double)(st->n - 1)) : 0.0f;
+}
+
+void adc_app_stats_reset(void)
+{
+    memset(adc_stats, 0, sizeof(adc_stats));
+    adc_result_seq_gaps = 0;
+}
+
+uint32_t adc_app_blocks(void)
+{
+    return adc_result_blocks;
+}
+
+uint32_t adc_app_seq_gaps(void)
+{
+    return adc_result_seq_gaps;
+}
+
+uint16_t adc_app_run_id(void)
+{
+    return adc_run_id;
+}
+
+/*
+ * Snapshot of the running stream, straight from adc_dma_buf. Only the DMA
+ * NDTR counter is read; the ADC itself is never touched, so a console read
+ * costs a few microseconds and never disturbs acquisition.
+ *
+ * n is capped at one half-buffer (ADC_BLOCK_FRAMES): the oldest frame read
+ * is then at least half a buffer ahead of the DMA write position, i.e. it
+ * cannot be overwritten for ADC_BLOCK_FRAMES trigger periods - far longer
+ * than the copy takes. The newest sample is at most one period old.
+ */
+uint32_t adc_app_snapshot(uint8_t idx, uint16_t *dst, uint32_t n)
+{
+    if (!adc_running || idx >= adc_nch)
+        return 0;
+
+    const uint32_t nch    = adc_nch;
+    const uint32_t frames = 2 * ADC_BLOCK_FRAMES;
+    uint32_t halves = adc_dma_halves;
+    uint32_t pos = frames * nch - __HAL_DMA_GET_COUNTER(hadc1.DMA_Handle);
+
+    // Only whole scan frames; the one in progress may be partly written
+    uint32_t end = (pos / nch) % frames;
+
+    uint32_t avail = (halves == 0) ? end : frames;
+    if (n > ADC_BLOCK_FRAMES)
+        n = ADC_BLOCK_FRAMES;
+    if (n > avail)
+        n = avail;
+
+    uint32_t f = (end + frames - n) % frames;
+
+    for (uint32_t i = 0; i < n; i++) {
+        dst[i] = adc_dma_buf[f * nch + idx];
+        if (++f == frames)
+            f = 0;
     }
-    return sum / samples;
+
+    return n;
+}
+
+/* Mean of the last n samples of rank idx; returns the count actually used */
+uint32_t adc_app_snapshot_mean(uint8_t idx, uint32_t n, uint16_t *mean)
+{
+    uint16_t buf[ADC_BLOCK_FRAMES];
+    uint32_t got = adc_app_snapshot(idx, buf, n);
+    uint32_t sum = 0;
+
+    for (uint32_t i = 0; i < got; i++)
+        sum += buf[i];
+
+    *mean = got ? (uint16_t)((sum + got / 2) / got) : 0;
+
+    return got;
 }
 
 uint32_t adc_to_voltage(uint16_t raw)
@@ -101,16 +686,17 @@ float adc_to_ntc_resistance(uint16_t raw, float rdiv)
     return rdiv * v / (3.3f - v);
 }
 
+// float reference for ntc_table; the console path uses the LUT in ntc.h
 float thermistor_beta_to_celsius(uint16_t raw)
 {
     if (raw <= 0 || raw >= 4095)
         return -273.15f;
 
     const float VREF = 3.3f;
-    const float R_PULLUP = 10000.0f;
-    const float R0 = 2200.0f;      // 2.2k @ 25C
-    const float BETA = 3950.0f;
-    const float T0 = 298.15f;      // 25C in Kelvin
+    const float R_PULLUP = (float)NTC_R_PULLUP_OHM;
+    const float R0 = (float)NTC_R0_OHM;
+    const float BETA = (float)NTC_BETA;
+    const float T0 = NTC_T0_C + 273.15f;
 
     float v = (raw / 4095.0f) * VREF;
     float r_ntc = R_PULLUP * v / (VREF - v);
@@ -0,0 +1,148 @@
+#include "adc_conv.h"
+#include "adc_app.h"
+#include "cycles.h"
+#include "main.h"
+#include <string.h>
+
+#define ADC_CONV_BENCH_LEN    64
+#define ADC_CONV_BENCH_ROUNDS 32
+
+/*
+ * x / 4095 == (x + (x >> 12) + 1) >> 12 for every x < 2^24 - 1 (it first
+ * fails at 2^24 - 1 = 4095 * 4097), and 4095 * ADC_CONV_VREF_MV stays
+ * below that, so no reciprocal rounding.
+ */
+static inline uint32_t div4095(uint32_t x)
+{
+    return (x + (x >> 12) + 1) >> 12;
+}
+
+/*
+ * Each output is one independent product, which the dual-16 MACs can't
+ * give two of at once (they sum the pair), and MUL is single-cycle on
+ * the M4 anyway. What pairing does save is half the loads and stores.
+ */
+void adc_conv_mv_block(const uint16_t *raw, uint16_t *mv, uint32_t n)
+{
+    uint32_t i = 0;
+
+    for (; i + 2 <= n; i += 2) {
+        uint32_t w;
+        memcpy(&w, &raw[i], 4);              // single LDR, unaligned is fine on M4
+
+        uint32_t lo = div4095((w & 0xFFFF) * ADC_CONV_VREF_MV);
+        uint32_t hi = div4095((w >> 16) * ADC_CONV_VREF_MV);
+
+        w = lo | (hi << 16);
+        memcpy(&mv[i], &w, 4);
+    }
+
+    for (; i < n; i++)
+        mv[i] = (uint16_t)div4095((uint32_t)raw[i] * ADC_CONV_VREF_MV);
+}
+
+/*
+ * Map code 0 -> at_zero and code 4095 -> at_full. Picks the largest
+ * shift that keeps the slope in 16 bits. Error is at most
+ * 0.5 + 2048 / 2^shift units; results saturate to int16.
+ */
+int adc_conv_init(adc_conv_t *c, int32_t at_zero, int32_t at_full)
+{
+    if (at_zero < INT16_MIN || at_zero > INT16_MAX ||
+        at_full < INT16_MIN || at_full > INT16_MAX)
+        return -1;
+
+    int32_t span  = at_full - at_zero;
+    uint8_t shift = 15;
+    int32_t gain;
+
+    for (;;) {
+        int64_t num = (int64_t)span << shift;
+        gain = (int32_t)((num + (num >= 0 ? 2047 : -2047)) / 4095);
+
+        if ((gain <= INT16_MAX && gain >= INT16_MIN) || shift == 0)
+            break;
+        shift--;
+    }
+
+    c->gain   = (int16_t)gain;
+    c->shift  = shift;
+    c->offset = at_zero * (1 << shift) + (shift ? (1 << (shift - 1)) : 0);
+
+    return 0;
+}
+
+void adc_conv_block(const adc_conv_t *c, const uint16_t *raw, int16_t *out, uint32_t n)
+{
+    const int32_t off = c->offset;
+    const uint8_t sh  = c->shift;
+    uint32_t i = 0;
+
+    const int32_t g = c->gain;
+
+    // paired LDR/STR as in adc_conv_mv_block; one MLA per sample
+    for (; i + 2 <= n; i += 2) {
+        uint32_t w;
+        memcpy(&w, &raw[i], 4);
+
+        int32_t lo = __SSAT(((int32_t)(w & 0xFFFF) * g + off) >> sh, 16);
+        int32_t hi = __SSAT(((int32_t)(w >> 16) * g + off) >> sh, 16);
+
+        w = ((uint32_t)lo & 0xFFFF) | ((uint32_t)hi << 16);
+        memcpy(&out[i], &w, 4);
+    }
+
+    for (; i < n; i++) {
+        int32_t y = ((int32_t)raw[i] * c->gain + off) >> sh;
+        out[i] = (int16_t)(y > INT16_MAX ? INT16_MAX : y < INT16_MIN ? INT16_MIN : y);
+    }
+}
+
+/*
+ * Cycles per sample for the scalar reference and both block kernels,
+ * plus an exhaustive check of the mV kernel. Console use only.
+ */
+void adc_conv_bench(adc_conv_bench_t *r)
+{
+    static uint16_t in[ADC_CONV_BENCH_LEN];
+    static uint16_t mv[ADC_CONV_BENCH_LEN];
+    static int16_t  eu[ADC_CONV_BENCH_LEN];
+    volatile uint32_t sink = 0;
+    adc_conv_t c;
+    uint32_t t0;
+    const uint32_t total = ADC_CONV_BENCH_LEN * ADC_CONV_BENCH_ROUNDS;
+
+    r->mismatches = 0;
+    for (uint32_t base = 0; base < 4096; base += ADC_CONV_BENCH_LEN) {
+        for (uint32_t i = 0; i < ADC_CONV_BENCH_LEN; i++)
+            in[i] = (uint16_t)(base + i);
+
+        adc_conv_mv_block(in, mv, ADC_CONV_BENCH_LEN);
+
+        for (uint32_t i = 0; i < ADC_CONV_BENCH_LEN; i++)
+            if (mv[i] != adc_to_voltage(in[i]))
+                r->mismatches++;
+    }
+
+    for (uint32_t i = 0; i < ADC_CONV_BENCH_LEN; i++)
+        in[i] = (uint16_t)((i * 67u) & 0x0FFF);
+
+    t0 = cycles_now();
+    for (uint32_t k = 0; k < ADC_CONV_BENCH_ROUNDS; k++)
+        for (uint32_t i = 0; i < ADC_CONV_BENCH_LEN; i++)
+            sink += adc_to_voltage(in[i]);
+    r->scalar_x100 = ((cycles_now() - t0) * 100u) / total;
+
+    t0 = cycles_now();
+    for (uint32_t k = 0; k < ADC_CONV_BENCH_ROUNDS; k++)
+        adc_conv_mv_block(in, mv, ADC_CONV_BENCH_LEN);
+    r->mv_x100 = ((cycles_now() - t0) * 100u) / total;
+
+    adc_conv_init(&c, -1000, 1000);
+    t0 = cycles_now();
+    for (uint32_t k = 0; k < ADC_CONV_BENCH_ROUNDS; k++)
+        adc_conv_block(&c, in, eu, ADC_CONV_BENCH_LEN);
+    r->units_x100 = ((cycles_now() - t0) * 100u) / total;
+
+    (void)sink;
+}
@@ -0,0 +1,186 @@
+#include "adc_history.h"
+#include "adc_ring.h"
+#include <string.h>
+
+#define ADC_HIST_TICK_MS 1000u
+
+#define ADC_HIST_LEN_1S  60
+#define ADC_HIST_LEN_10S 60
+#define ADC_HIST_LEN_1M  60
+#define ADC_HIST_LEN_1H  24
+
+typedef struct {
+    const char *name;
+    uint16_t    len;        // closed buckets kept
+    uint16_t    fold;       // buckets of this level per bucket of the next
+} adc_hist_level_cfg_t;
+
+static const adc_hist_level_cfg_t adc_hist_cfg[ADC_HIST_LEVELS] =
+{
+    { "1s",  ADC_HIST_LEN_1S,  10 },    // 1 min of 1 s buckets
+    { "10s", ADC_HIST_LEN_10S, 6  },    // 10 min of 10 s buckets
+    { "1m",  ADC_HIST_LEN_1M,  60 },    // 1 h of 1 min buckets
+    { "1h",  ADC_HIST_LEN_1H,  0  },    // 1 day of 1 h buckets
+};
+
+typedef struct {
+    adc_hist_bucket_t open;     // bucket currently being filled
+    uint16_t          folded;   // closed children merged into open
+    uint16_t          head;     // next write slot in ring
+    uint16_t          used;
+} adc_hist_state_t;
+
+typedef struct {
+    uint32_t          open_ms;  // start of the open 1 s bucket
+    uint8_t           active;
+    adc_hist_state_t  st[ADC_HIST_LEVELS];
+    adc_hist_bucket_t l1s[ADC_HIST_LEN_1S];
+    adc_hist_bucket_t l10s[ADC_HIST_LEN_10S];
+    adc_hist_bucket_t l1m[ADC_HIST_LEN_1M];
+    adc_hist_bucket_t l1h[ADC_HIST_LEN_1H];
+} adc_hist_t;
+
+static adc_hist_t adc_hist[ADC_MAX_CHANNELS];
+
+static adc_hist_bucket_t *adc_hist_ring(adc_hist_t *h, uint8_t level)
+{
+    switch (level) {
+    case ADC_HIST_1S:  return h->l1s;
+    case ADC_HIST_10S: return h->l10s;
+    case ADC_HIST_1M:  return h->l1m;
+    default:           return h->l1h;
+    }
+}
+
+static void adc_hist_merge(adc_hist_bucket_t *dst, const adc_hist_bucket_t *src)
+{
+    if (src->count == 0)
+        return;
+
+    if (dst->count == 0 || src->min < dst->min) dst->min = src->min;
+    if (dst->count == 0 || src->max > dst->max) dst->max = src->max;
+    dst->sum   += src->sum;
+    dst->count += src->count;
+}
+
+/*
+ * Close the open 1 s bucket and n - 1 empty ones after it, cascading
+ * into the coarser levels. Only the first close at each level carries
+ * data, so the rest is arithmetic: at most len empty buckets are written
+ * per level and the fold counters advance by the whole count at once.
+ */
+static void adc_hist_close(adc_hist_t *h, uint32_t n)
+{
+    static const adc_hist_bucket_t empty;
+
+    for (uint8_t level = 0; n > 0; level++) {
+        adc_hist_state_t *st = &h->st[level];
+        const adc_hist_level_cfg_t *cfg = &adc_hist_cfg[level];
+        adc_hist_bucket_t *ring = adc_hist_ring(h, level);
+        uint32_t k = n < cfg->len ? n : cfg->len;     // closes that stay in the ring
+        uint32_t slot = (st->head + (n - k) % cfg->len) % cfg->len;
+
+        for (uint32_t i = 0; i < k; i++) {
+            ring[slot] = (i == 0 && k == n) ? st->open : empty;
+            if (++slot == cfg->len)
+                slot = 0;
+        }
+        st->head = (uint16_t)slot;
+        st->used = (uint16_t)(st->used + k < cfg->len ? st->used + k : cfg->len);
+
+        if (level + 1 == ADC_HIST_LEVELS) {
+            st->open = empty;
+            return;
+        }
+
+        adc_hist_state_t *up = &h->st[level + 1];
+        uint32_t folded = up->folded + n;
+
+        adc_hist_merge(&up->open, &st->open);
+        st->open = empty;
+
+        up->folded = (uint16_t)(folded % cfg->fold);
+        n = folded / cfg->fold;
+    }
+}
+
+void adc_history_reset(void)
+{
+    memset(adc_hist, 0, sizeof(adc_hist));
+}
+
+// Close level 0 buckets up to the one holding t, empty ones included
+static void adc_hist_advance(adc_hist_t *h, uint32_t t)
+{
+    uint32_t gap = (t - h->open_ms) / ADC_HIST_TICK_MS;
+
+    h->open_ms += gap * ADC_HIST_TICK_MS;
+    adc_hist_close(h, gap);
+}
+
+void adc_history_add(uint8_t idx, uint32_t end_ms, const uint16_t *x,
+                     uint32_t n, uint32_t rate_hz)
+{
+    adc_hist_t *h = &adc_hist[idx];
+    uint32_t t0 = end_ms - (n - 1) * 1000u / rate_hz;
+    adc_hist_bucket_t part = { 0 };
+
+    if (!h->active) {
+        h->active  = 1;
+        h->open_ms = t0;
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t t = t0 + i * 1000u / rate_hz;
+
+        // a sample stamped a little before open_ms (jitter) stays in it
+        if ((int32_t)(t - h->open_ms) >= (int32_t)ADC_HIST_TICK_MS) {
+            adc_hist_merge(&h->st[ADC_HIST_1S].open, &part);
+            memset(&part, 0, sizeof(part));
+            adc_hist_advance(h, t);
+        }
+
+        uint16_t v = x[i];
+
+        if (part.count == 0 || v < part.min) part.min = v;
+        if (part.count == 0 || v > part.max) part.max = v;
+        part.sum += v;
+        part.count++;
+    }
+
+    adc_hist_merge(&h->st[ADC_HIST_1S].open, &part);
+}
+
+int adc_history_level(const char *name)
+{
+    for (uint8_t i = 0; i < ADC_HIST_LEVELS; i++) {
+        if (!strcmp(name, adc_hist_cfg[i].name))
+            return i;
+    }
+    return -1;
+}
+
+const char *adc_history_level_name(uint8_t level)
+{
+    return adc_hist_cfg[level].name;
+}
+
+uint32_t adc_history_level_len(uint8_t level)
+{
+    return adc_hist_cfg[level].len;
+}
+
+int adc_history_get(uint8_t idx, uint8_t level, uint32_t age,
+                    adc_hist_bucket_t *dst)
+{
+    adc_hist_t *h = &adc_hist[idx];
+    const adc_hist_state_t *st = &h->st[level];
+    uint32_t len = adc_hist_cfg[level].len;
+
+    if (age >= st->used)
+        return 0;
+
+    *dst = adc_hist_ring(h, level)[(st->head + len - 1 - age) % len];
+
+    return 1;
+}
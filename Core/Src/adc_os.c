@@ -0,0 +1,59 @@
+#include "adc_os.h"
+#include <string.h>
+
+#define ADC_OS_OUT_MASK (ADC_OS_OUT_LEN - 1)
+
+void adc_os_init(adc_os_t *os, uint8_t bits)
+{
+    memset(os, 0, sizeof(*os));
+    os->bits = bits > ADC_OS_MAX_BITS ? ADC_OS_MAX_BITS : bits;
+}
+
+void adc_os_process(adc_os_t *os, const uint16_t *x, uint32_t n)
+{
+    const uint8_t  bits  = os->bits;
+    const uint32_t ratio = 1u << (2 * bits);
+    uint32_t acc = os->acc;
+    uint32_t cnt = os->cnt;
+    uint32_t wr  = os->produced;
+
+    // 256 x 4095 still fits comfortably in 32 bits
+    for (uint32_t i = 0; i < n; i++) {
+        acc += x[i];
+
+        if (++cnt == ratio) {
+            os->out[wr & ADC_OS_OUT_MASK] = (uint16_t)(acc >> bits);
+            wr++;
+            acc = 0;
+            cnt = 0;
+        }
+    }
+
+    os->acc      = acc;
+    os->cnt      = cnt;
+    os->produced = wr;
+}
+
+uint16_t adc_os_latest(const adc_os_t *os)
+{
+    if (os->produced == 0)
+        return 0;
+
+    return os->out[(os->produced - 1) & ADC_OS_OUT_MASK];
+}
+
+/* Copy up to n of the most recent outputs, oldest first */
+uint32_t adc_os_read(const adc_os_t *os, uint16_t *dst, uint32_t n)
+{
+    uint32_t avail = os->produced < ADC_OS_OUT_LEN ? os->produced : ADC_OS_OUT_LEN;
+
+    if (n > avail)
+        n = avail;
+
+    uint32_t rd = os->produced - n;
+
+    for (uint32_t i = 0; i < n; i++)
+        dst[i] = os->out[(rd + i) & ADC_OS_OUT_MASK];
+
+    return n;
+}
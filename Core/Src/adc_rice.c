@@ -0,0 +1,122 @@
+#include "adc_rice.h"
+#include "adc_stream_proto.h"
+
+#define RICE_RAW_BITS 12
+#define RICE_K_MAX    14
+
+typedef struct {
+    uint8_t *p;
+    uint8_t *end;
+    uint32_t acc;       // pending bits, left-aligned at bit `nbits - 1`
+    uint8_t  nbits;
+    uint8_t  overflow;
+} bitwriter_t;
+
+static inline void bw_put(bitwriter_t *bw, uint32_t v, uint8_t n)   // n <= 24
+{
+    bw->acc = (bw->acc << n) | (v & ((1u << n) - 1u));
+    bw->nbits += n;
+
+    while (bw->nbits >= 8) {
+        bw->nbits -= 8;
+        if (bw->p == bw->end) {
+            bw->overflow = 1;
+            return;
+        }
+        *bw->p++ = (uint8_t)(bw->acc >> bw->nbits);
+    }
+}
+
+static inline void bw_flush(bitwriter_t *bw)
+{
+    if (bw->nbits)
+        bw_put(bw, 0, (uint8_t)(8 - bw->nbits));
+}
+
+static inline uint32_t zigzag(int32_t e)
+{
+    return e >= 0 ? (uint32_t)e << 1 : ((uint32_t)(-e) << 1) - 1u;
+}
+
+static inline int32_t predict(const uint16_t *x, uint32_t i, uint8_t order)
+{
+    if (order == 0)
+        return 0;
+    if (order == 1)
+        return x[i - 1];
+    return 2 * (int32_t)x[i - 1] - (int32_t)x[i - 2];
+}
+
+static uint32_t encode_verbatim(const uint16_t *x, uint32_t n, uint8_t *out, uint32_t cap)
+{
+    bitwriter_t bw = { out, out + cap, 0, 0, 0 };
+
+    bw_put(&bw, ADC_RICE_MODE_VERBATIM << 6, 8);
+    for (uint32_t i = 0; i < n; i++)
+        bw_put(&bw, x[i], RICE_RAW_BITS);
+    bw_flush(&bw);
+
+    return bw.overflow ? 0 : (uint32_t)(bw.p - out);
+}
+
+uint32_t adc_rice_encode(const uint16_t *x, uint32_t n, uint8_t *out, uint32_t cap)
+{
+    uint32_t sum[3] = { 0, 0, 0 };
+
+    // pick the fixed predictor with the smallest residual magnitude;
+    // all three are scored over the same samples (i >= 2)
+    for (uint32_t i = 2; i < n; i++) {
+        int32_t x0 = x[i], x1 = x[i - 1], x2 = x[i - 2];
+        int32_t e1 = x0 - x1;
+        int32_t e2 = e1 - (x1 - x2);
+
+        sum[0] += (uint32_t)x0;
+        sum[1] += (uint32_t)(e1 < 0 ? -e1 : e1);
+        sum[2] += (uint32_t)(e2 < 0 ? -e2 : e2);
+    }
+
+    uint8_t order = 0;
+    if (sum[1] < sum[order]) order = 1;
+    if (sum[2] < sum[order]) order = 2;
+
+    if (n <= order)
+        return encode_verbatim(x, n, out, cap);
+
+    // zigzag roughly doubles |e|: choose k with 2^k near the mean of u
+    uint32_t m = n > 2 ? n - 2 : 1;
+    uint32_t usum = 2 * sum[order];
+    uint8_t k = 0;
+
+    while (k < RICE_K_MAX && ((uint64_t)m << (k + 1)) <= usum)
+        k++;
+
+    bitwriter_t bw = { out, out + cap, 0, 0, 0 };
+
+    bw_put(&bw, (uint32_t)(order << 6) | k, 8);
+    for (uint32_t i = 0; i < order; i++)
+        bw_put(&bw, x[i], RICE_RAW_BITS);
+
+    for (uint32_t i = order; i < n && !bw.overflow; i++) {
+        uint32_t u = zigzag((int32_t)x[i] - predict(x, i, order));
+        uint32_t q = u >> k;
+
+        if (q < ADC_RICE_QMAX) {
+            bw_put(&bw, (1u << (q + 1)) - 2u, (uint8_t)(q + 1));   // q ones, a zero
+            if (k)
+                bw_put(&bw, u, k);
+        } else {
+            bw_put(&bw, (1u << ADC_RICE_QMAX) - 1u, ADC_RICE_QMAX);
+            bw_put(&bw, u, ADC_RICE_ESC_BITS);
+        }
+    }
+    bw_flush(&bw);
+
+    uint32_t len = (uint32_t)(bw.p - out);
+    uint32_t raw = 1 + (n * RICE_RAW_BITS + 7) / 8;
+
+    // noisy or fast-changing input: fall back rather than expand
+    if (bw.overflow || len >= raw)
+        return encode_verbatim(x, n, out, cap);
+
+    return len;
+}
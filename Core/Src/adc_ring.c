@@ -0,0 +1,75 @@
+#include "adc_ring.h"
+#include "main.h"
+
+#define ADC_RING_MASK (ADC_RING_SLOTS - 1)
+
+static adc_block_t adc_ring_slots[ADC_RING_SLOTS];
+
+// Free-running indices; (head - tail) is the fill level even across wrap
+static volatile uint32_t adc_ring_head = 0;
+static volatile uint32_t adc_ring_tail = 0;
+
+static volatile uint32_t adc_ring_produced = 0;
+static volatile uint32_t adc_ring_dropped  = 0;
+
+void adc_ring_reset(void)
+{
+    // Only valid while the producer is stopped
+    adc_ring_head     = 0;
+    adc_ring_tail     = 0;
+    adc_ring_produced = 0;
+    adc_ring_dropped  = 0;
+}
+
+adc_block_t *adc_ring_acquire(void)
+{
+    uint32_t head = adc_ring_head;
+
+    if (head - adc_ring_tail >= ADC_RING_SLOTS) {
+        // Consumer is behind: lose this block, keep what is queued
+        adc_ring_dropped++;
+        return NULL;
+    }
+
+    adc_block_t *blk = &adc_ring_slots[head & ADC_RING_MASK];
+    blk->seq = adc_ring_produced + adc_ring_dropped;
+
+    return blk;
+}
+
+void adc_ring_publish(void)
+{
+    // Block contents must be visible before the consumer sees the new head
+    __DMB();
+    adc_ring_head = adc_ring_head + 1;
+    adc_ring_produced++;
+}
+
+const adc_block_t *adc_ring_peek(void)
+{
+    uint32_t tail = adc_ring_tail;
+
+    if (tail == adc_ring_head)
+        return NULL;
+
+    __DMB();
+    return &adc_ring_slots[tail & ADC_RING_MASK];
+}
+
+void adc_ring_release(void)
+{
+    // Finish reading the slot before handing it back to the producer
+    __DMB();
+    adc_ring_tail = adc_ring_tail + 1;
+}
+
+void adc_ring_get_stats(adc_ring_stats_t *st)
+{
+    uint32_t head = adc_ring_head;
+    uint32_t tail = adc_ring_tail;
+
+    st->produced = adc_ring_produced;
+    st->dropped  = adc_ring_dropped;
+    st->consumed = tail;
+    st->level    = head - tail;
+}
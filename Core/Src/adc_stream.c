@@ -0,0 +1,138 @@
+#include "adc_stream.h"
+#include "adc_stream_proto.h"
+#include "adc_app.h"
+#include "adc_rice.h"
+#include "console.h"
+#include "cycles.h"
+#include <string.h>
+
+#if ADC_STREAM_HDR_SIZE + ADC_MAX_CHANNELS * ADC_BLOCK_FRAMES * 2 + 2 > CONSOLE_FRAME_MAX
+#error "largest stream packet does not fit CONSOLE_FRAME_MAX"
+#endif
+
+static uint8_t adc_stream_on;
+static uint8_t adc_stream_held;
+static uint8_t adc_stream_first;
+static uint8_t adc_stream_rice_on;
+static adc_stream_stats_t adc_stream_stats;
+
+static uint8_t adc_stream_coded[ADC_RICE_MAX_BYTES(ADC_MAX_CHANNELS, ADC_BLOCK_FRAMES)];
+
+void adc_stream_enable(uint8_t on)
+{
+    if (on && !adc_stream_on) {
+        memset(&adc_stream_stats, 0, sizeof(adc_stream_stats));
+        adc_stream_first = 1;
+    }
+    adc_stream_on = on ? 1 : 0;
+}
+
+uint8_t adc_stream_enabled(void)
+{
+    return adc_stream_on;
+}
+
+// Suppress packets without touching on/off or the stats, e.g. while the
+// console owns the link; the first packet after release starts a new run
+void adc_stream_hold(uint8_t on)
+{
+    if (!on && adc_stream_held)
+        adc_stream_first = 1;
+    adc_stream_held = on ? 1 : 0;
+}
+
+void adc_stream_set_rice(uint8_t on)
+{
+    adc_stream_rice_on = on ? 1 : 0;
+}
+
+uint8_t adc_stream_rice(void)
+{
+    return adc_stream_rice_on;
+}
+
+// Rice-code every rank into adc_stream_coded; returns the payload length
+static uint16_t adc_stream_encode(const adc_block_t *blk)
+{
+    uint32_t t0 = cycles_now();
+    uint32_t len = 0;
+
+    for (uint8_t i = 0; i < blk->nch; i++)
+        len += adc_rice_encode(blk->samples[i], ADC_BLOCK_FRAMES,
+                               &adc_stream_coded[len], sizeof(adc_stream_coded) - len);
+
+    adc_stream_stats.enc_cycles  += cycles_now() - t0;
+    adc_stream_stats.enc_samples += (uint32_t)blk->nch * ADC_BLOCK_FRAMES;
+
+    return (uint16_t)len;
+}
+
+void adc_stream_block(const adc_block_t *blk)
+{
+    adc_stream_hdr_t hdr;
+
+    if (!adc_stream_on || adc_stream_held)
+        return;
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic    = ADC_STREAM_MAGIC;
+    hdr.version  = ADC_STREAM_VERSION;
+    hdr.nch      = blk->nch;
+    hdr.rate_mhz = adc_app_get_rate_mhz();
+    hdr.seq      = blk->seq;
+    hdr.t0       = (uint64_t)blk->seq * ADC_BLOCK_FRAMES;
+    hdr.frames   = ADC_BLOCK_FRAMES;
+    hdr.run      = adc_app_run_id();
+
+    if (blk->seq == 0 || adc_stream_first)
+        hdr.flags |= ADC_STREAM_F_RUN_START;
+    adc_stream_first = 0;
+
+    for (uint8_t i = 0; i < blk->nch; i++) {
+        hdr.chan[i] = blk->chan[i];
+        hdr.chan_mask |= 1UL << blk->chan[i];
+    }
+
+    // samples[] rows are contiguous, so the used ranks are one span
+    const void *payload = blk->samples;
+    uint16_t raw_len = (uint16_t)(blk->nch * ADC_BLOCK_FRAMES * sizeof(uint16_t));
+    uint16_t len = raw_len;
+
+    if (adc_stream_rice_on) {
+        hdr.flags |= ADC_STREAM_F_RICE;
+        payload = adc_stream_coded;
+        len = adc_stream_encode(blk);
+    }
+
+    int n = console_write_frame(&hdr, sizeof(hdr), payload, len);
+
+    if (n < 0) {
+        adc_stream_stats.dropped++;
+    } else {
+        adc_stream_stats.packets++;
+        adc_stream_stats.bytes += (uint32_t)n;
+        adc_stream_stats.raw_payload += raw_len;
+        adc_stream_stats.sent_payload += len;
+    }
+}
+
+void adc_stream_get_stats(adc_stream_stats_t *st)
+{
+    *st = adc_stream_stats;
+}
+
+uint32_t adc_stream_wire_rate(void)
+{
+    uint32_t payload = adc_app_ch_count() * ADC_BLOCK_FRAMES * sizeof(uint16_t);
+
+    // compressed: scale by the ratio measured so far
+    if (adc_stream_rice_on && adc_stream_stats.raw_payload)
+        payload = (uint32_t)(((uint64_t)payload * adc_stream_stats.sent_payload)
+                             / adc_stream_stats.raw_payload);
+
+    uint32_t raw = ADC_STREAM_HDR_SIZE + 2 + payload;
+    uint32_t wire = raw + raw / 254 + 3;     // COBS overhead + two delimiters
+
+    return (uint32_t)(((uint64_t)wire * adc_app_get_rate_mhz())
+                      / (ADC_BLOCK_FRAMES * 1000u));
+}
@@ -1,99 +1,879 @@
 #include "adc_app.h"
+#include "adc_conv.h"
+#include "adc_history.h"
+#include "adc_ring.h"
+#include "adc_stream.h"
+#include "adc_stream_proto.h"
+#include "ntc.h"
+#include "watch.h"
+#include "timebase.h"
+#include "defer.h"
+#include "fmt.h"
 #include "console.h"
 #include "usart.h"
 #include "dma.h"
 #include <stdarg.h>
 #include <string.h>
-#include <stdio.h>
 #include <math.h>
 
-#define UART_RX_DMA_BUF_SIZE 128
+#define UART_RX_DMA_BUF_SIZE 2048		// ~10 ms of input at 2 Mbaud
+#define UART_RX_DMA_BUF_MASK (UART_RX_DMA_BUF_SIZE - 1)
+#define UART_TX_BUF_SIZE 4096
+#define UART_TX_BUF_MASK (UART_TX_BUF_SIZE - 1)
+#define UART_TX_FLUSH_THRESHOLD 256	// staged bytes that force an early flush
 #define LINE_BUF_SIZE 64
 
-typedef void (*console_cmd_fn_t)(int argc, char *argv[]);
+#if (UART_TX_BUF_SIZE & UART_TX_BUF_MASK) != 0
+#error "UART_TX_BUF_SIZE must be a power of two"
+#endif
 
-typedef struct {
+#if (UART_RX_DMA_BUF_SIZE & UART_RX_DMA_BUF_MASK) != 0
+#error "UART_RX_DMA_BUF_SIZE must be a power of two"
+#endif
+
+#define CONSOLE_MAX_ARGS 8
+
+/* commands return one of these; the dispatcher prints "ok" for CMD_OK */
+#define CMD_OK   0
+#define CMD_DONE 1		// handled, no "ok" (help, uptime)
+#define CMD_ERR  2		// handler already printed the error
+#define CMD_PENDING 3	// finishes later from task_console, which prints the prompt
+
+typedef int (*console_cmd_fn_t)(int argc, const console_arg_t *argv);
+
+/*
+ * Two-level registry. Each table must be sorted by name (checked once in
+ * console_init) so lookups are a binary search over pointer/length tokens.
+ * An entry with a sub table dispatches argv[1] there; the subcommand
+ * handler sees itself as argv[0].
+ */
+typedef struct console_cmd console_cmd_t;
+
+struct console_cmd {
 	const char *name;
-	console_cmd_fn_t fn;
+	console_cmd_fn_t fn;			// NULL: print the sub table as usage
 	const char *help;
-} console_cmd_t;
+	const console_cmd_t *sub;
+	uint8_t nsub;
+};
+
+#define SUBCMDS(t) (t), (uint8_t)(sizeof(t) / sizeof((t)[0]))
+
+static int cmd_led(int argc, const console_arg_t *argv);
+static int cmd_help(int argc, const console_arg_t *argv);
+static int cmd_uptime(int argc, const console_arg_t *argv);
+static int cmd_status(int argc, const console_arg_t *argv);
+static int cmd_tasks(int argc, const console_arg_t *argv);
+static int cmd_unwatch(int argc, const console_arg_t *argv);
+static int cmd_watch(int argc, const console_arg_t *argv);
+
+static int cmd_adc_avg(int argc, const console_arg_t *argv);
+static int cmd_adc_bench(int argc, const console_arg_t *argv);
+static int cmd_adc_ch(int argc, const console_arg_t *argv);
+static int cmd_adc_history(int argc, const console_arg_t *argv);
+static int cmd_adc_latest(int argc, const console_arg_t *argv);
+static int cmd_adc_os(int argc, const console_arg_t *argv);
+static int cmd_adc_rate(int argc, const console_arg_t *argv);
+static int cmd_adc_start(int argc, const console_arg_t *argv);
+static int cmd_adc_stats(int argc, const console_arg_t *argv);
+static int cmd_adc_stop(int argc, const console_arg_t *argv);
+static int cmd_adc_stream(int argc, const console_arg_t *argv);
+static int cmd_adc_temp(int argc, const console_arg_t *argv);
+static int cmd_adc_volts(int argc, const console_arg_t *argv);
 
-static void cmd_led(int argc, char *argv[]);
-static void cmd_help(int argc, char *argv[]);
-static void cmd_uptime(int argc, char *argv[]);
-static void cmd_status(int argc, char *argv[]);
-static void cmd_adc(int argc, char **argv);
+static int cmd_baud(int argc, const console_arg_t *argv);
+static int cmd_baud_list(int argc, const console_arg_t *argv);
+static int cmd_baud_ok(int argc, const console_arg_t *argv);
+static int cmd_baud_test(int argc, const console_arg_t *argv);
+
+static int cmd_uart_bench(int argc, const console_arg_t *argv);
+static int cmd_uart_stats(int argc, const console_arg_t *argv);
+static int cmd_uart_txpolicy(int argc, const console_arg_t *argv);
+
+static const console_cmd_t adc_cmds[] =
+{
+	{ "avg",     cmd_adc_avg, "             - block average per channel" },
+	{ "bench",   cmd_adc_bench, "           - conversion kernel cycles/sample" },
+	{ "ch",      cmd_adc_ch, " [add <n> [cycles]|del <n>] - scan sequence" },
+	{ "history", cmd_adc_history, " <1s|10s|1m|1h> [ch] [n]" },
+	{ "latest",  cmd_adc_latest, "          - newest sample per channel" },
+	{ "os",      cmd_adc_os, " [<ch> <0..4>] - oversampling" },
+	{ "rate",    cmd_adc_rate, " [hz]          - sample rate" },
+	{ "start",   cmd_adc_start, "           - start acquisition" },
+	{ "stats",   cmd_adc_stats, " [reset]   - statistics and ring counters" },
+	{ "stop",    cmd_adc_stop, "            - stop acquisition" },
+	{ "stream",  cmd_adc_stream, " [on [rice]|off] - binary stream" },
+	{ "temp",    cmd_adc_temp, " [check]       - thermistor" },
+	{ "volts",   cmd_adc_volts, "           - average in mV" },
+};
+
+static const console_cmd_t baud_cmds[] =
+{
+	{ "list", cmd_baud_list, "         - candidate rates and their BRR error" },
+	{ "ok",   cmd_baud_ok, "           - host acknowledges a pending switch" },
+	{ "test", cmd_baud_test, " [bytes]   - measure TX throughput at this rate" },
+};
+
+static const console_cmd_t uart_cmds[] =
+{
+	{ "bench",    cmd_uart_bench, "    - formatter cycles per line" },
+	{ "stats",    cmd_uart_stats, " [reset]" },
+	{ "txpolicy", cmd_uart_txpolicy, " [block|drop|trunc]" },
+};
 
 static const console_cmd_t cmd_table[] =
 {
-	{ "help",   cmd_help, "   - show this help" },
-	{ "status", cmd_status, " - system status" },
-	{ "uptime", cmd_uptime, " - system uptime" },
-	{ "led",    cmd_led, "    - led off|slow|fast" },
-	{ "adc",    cmd_adc, "    - adc start|stop|volts|latest|avg|temp" },
+	{ "adc",    NULL, "    - adc start|stop|rate|ch|os|stats [reset]|history|stream|bench|volts|latest|avg|temp [check]", SUBCMDS(adc_cmds) },
+	{ "baud",   cmd_baud, "   - baud [<rate>|list|test [bytes]]", SUBCMDS(baud_cmds) },
+	{ "help",   cmd_help, "   - show this help, help <cmd> for subcommands", NULL, 0 },
+	{ "led",    cmd_led, "    - led off|slow|fast", NULL, 0 },
+	{ "status", cmd_status, " - system status", NULL, 0 },
+	{ "tasks",  cmd_tasks, "  - per-task run time and start lateness [reset]", NULL, 0 },
+	{ "uart",   NULL, "   - uart stats [reset]|txpolicy [block|drop|trunc]|bench", SUBCMDS(uart_cmds) },
+	{ "unwatch", cmd_unwatch, " - unwatch [metric], all if none given", NULL, 0 },
+	{ "uptime", cmd_uptime, " - system uptime", NULL, 0 },
+	{ "watch",  cmd_watch, "  - watch [<metric> <period>[ms|s|m]]", NULL, 0 },
 };
 
-#define CMD_COUNT (sizeof(cmd_table) / sizeof(cmd_table[0]))
+#define CMD_COUNT ((uint8_t)(sizeof(cmd_table) / sizeof(cmd_table[0])))
 
+/*
+ * RX: circular DMA into uart_rx_dma_buf. rx_written counts every byte the
+ * DMA has stored; it is advanced from the half/full-transfer callbacks
+ * and IDLE, so even a silent lap of the buffer is seen at least twice.
+ * task_console reads from rx_read; rx_written - rx_read > buffer size
+ * means the DMA overwrote bytes we had not parsed yet.
+ */
 static uint8_t uart_rx_dma_buf[UART_RX_DMA_BUF_SIZE];
-static uint16_t dma_last_pos = 0;
-volatile uint8_t rx_pending = 0;
+static volatile uint32_t rx_written;
+static uint32_t rx_dma_pos;			// buffer index at the last advance
+static uint32_t rx_read;
+static console_rx_stats_t rx_stats;
 
 static char line_buf[LINE_BUF_SIZE];
 static uint8_t line_len = 0;
+static uint8_t line_skip;			// drop input up to the next end of line
+static uint8_t line_overflow;
+static char rx_last;
 
+static void console_rx_advance(void);
+static void console_rx_poll(void);
+static void console_schedule(void);
 static void console_process_bytes(uint8_t *data, uint16_t len);
 
+/*
+ * TX ring drained by USART2 TX DMA (DMA1_Stream6). Writers copy in and
+ * return; the TC callback advances tx_tail and starts the next chunk.
+ * tx_head is only written from thread context, tx_tail only from the ISR
+ * (or with interrupts masked in console_tx_kick).
+ *
+ * tail <= flushed <= head: the DMA only ever sends up to tx_flushed.
+ * While task_console runs (tx_hold) writes are staged between flushed
+ * and head, so echo, the reply, "ok" and the prompt of every command in
+ * that tick leave as one transfer.
+ */
+static uint8_t tx_buf[UART_TX_BUF_SIZE];
+static volatile uint32_t tx_head;
+static volatile uint32_t tx_tail;
+static volatile uint32_t tx_flushed;
+static volatile uint16_t tx_inflight;
+static uint8_t tx_hold;
+static volatile uint8_t tx_wake;		// activate task_console when a TX chunk completes
+static console_tx_policy_t tx_policy = CONSOLE_TX_BLOCK;
+static console_tx_stats_t tx_stats;
+
+static const char *const tx_policy_names[] = { "block", "drop", "trunc" };
+
+/* start the next contiguous chunk if the DMA is idle; safe from ISR */
+static void console_tx_kick(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (tx_inflight == 0 && tx_flushed != tx_tail) {
+		uint32_t off = tx_tail & UART_TX_BUF_MASK;
+		uint32_t len = tx_flushed - tx_tail;
+
+		if (len > UART_TX_BUF_SIZE - off)
+			len = UART_TX_BUF_SIZE - off;		// wrap: send up to the end first
+
+		if (HAL_UART_Transmit_DMA(&huart2, &tx_buf[off], (uint16_t)len) == HAL_OK) {
+			tx_inflight = (uint16_t)len;
+			tx_stats.dma_xfers++;
+		}
+	}
+
+	__set_PRIMASK(primask);
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+	if (huart != &huart2)
+		return;
+
+	tx_tail += tx_inflight;
+	tx_stats.bytes_sent += tx_inflight;
+	tx_inflight = 0;
+
+	console_tx_kick();
+
+	if (tx_wake)
+		task_activate(TASK_ID_CONSOLE);
+}
+
+/* hand everything staged to the DMA */
+static void console_tx_flush(void)
+{
+	uint32_t n = tx_head - tx_flushed;
+
+	if (n > 0) {
+		tx_stats.flushes++;
+		tx_stats.flush_bytes += n;
+		if (n > tx_stats.flush_max)
+			tx_stats.flush_max = n;
+		tx_flushed = tx_head;
+	}
+
+	console_tx_kick();
+}
+
+static uint32_t console_tx_free(void)
+{
+	return UART_TX_BUF_SIZE - (tx_head - tx_tail);
+}
+
+/*
+ * Writers fill the ring at a private head and publish it when done, so a
+ * formatted message goes straight into tx_buf with no line buffer. Only
+ * CONSOLE_TX_BLOCK publishes early, when the ring is full and it has to
+ * wait for the DMA to make room.
+ */
+typedef struct {
+	fmt_sink_t sink;
+	uint32_t head;
+	uint32_t offered;
+	uint32_t lost;			// bytes that found no room (DROP/TRUNC)
+	uint8_t waited;
+} tx_writer_t;
+
+static void tx_writer_put(fmt_sink_t *s, const char *p, uint32_t n)
+{
+	tx_writer_t *w = (tx_writer_t *)s;
+
+	w->offered += n;
+
+	while (n > 0) {
+		uint32_t room = UART_TX_BUF_SIZE - (w->head - tx_tail);
+
+		if (room == 0) {
+			if (tx_policy != CONSOLE_TX_BLOCK) {
+				w->lost += n;
+				return;
+			}
+			w->waited = 1;
+			__DMB();
+			tx_head = w->head;
+			console_tx_flush();		// CONSOLE_TX_BLOCK: wait for the DMA
+			continue;
+		}
+
+		uint32_t off = w->head & UART_TX_BUF_MASK;
+		uint32_t k = n < room ? n : room;
+
+		if (k > UART_TX_BUF_SIZE - off)
+			k = UART_TX_BUF_SIZE - off;
+
+		memcpy(&tx_buf[off], p, k);
+		w->head += k;
+		p += k;
+		n -= k;
+	}
+}
+
+static void tx_writer_begin(tx_writer_t *w)
+{
+	w->sink.put = tx_writer_put;
+	w->head = tx_head;
+	w->offered = 0;
+	w->lost = 0;
+	w->waited = 0;
+}
+
+static void tx_writer_end(tx_writer_t *w)
+{
+	if (w->waited)
+		tx_stats.blocked++;
+
+	if (w->lost && tx_policy == CONSOLE_TX_DROP) {
+		tx_stats.dropped_msgs++;
+		tx_stats.dropped_bytes += w->offered;
+		return;						// never published: the message is gone whole
+	}
+	tx_stats.truncated_bytes += w->lost;
+	tx_stats.bytes_queued += w->offered - w->lost;
+
+	__DMB();
+	tx_head = w->head;
+
+	uint32_t level = tx_head - tx_tail;
+	if (level > tx_stats.high_water)
+		tx_stats.high_water = level;
+
+	if (!tx_hold)
+		console_tx_flush();
+	else if (tx_head - tx_flushed >= UART_TX_FLUSH_THRESHOLD) {
+		tx_stats.early_flushes++;
+		console_tx_flush();
+	}
+}
+
+static void console_tx_put(const uint8_t *data, uint32_t len)
+{
+	tx_writer_t w;
+
+	tx_writer_begin(&w);
+	tx_writer_put(&w.sink, (const char *)data, len);
+	tx_writer_end(&w);
+}
+
+/*
+ * Binary frames: 0x00 COBS(a | b | crc16) 0x00, queued whole or not at
+ * all so a full ring never leaves a torn frame on the wire.
+ */
+#define FRAME_ENC_SIZE (CONSOLE_FRAME_MAX + CONSOLE_FRAME_MAX / 254 + 4)
+
+static uint8_t frame_enc[FRAME_ENC_SIZE];
+static uint16_t crc16_table[256];
+
+static void crc16_init_table(void)
+{
+	for (uint32_t i = 0; i < 256; i++) {
+		uint16_t crc = (uint16_t)(i << 8);
+		for (uint8_t b = 0; b < 8; b++)
+			crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ ADC_STREAM_CRC_POLY)
+								 : (uint16_t)(crc << 1);
+		crc16_table[i] = crc;
+	}
+}
+
+static uint16_t crc16_update(uint16_t crc, const uint8_t *p, uint32_t n)
+{
+	while (n--)
+		crc = (uint16_t)((crc << 8) ^ crc16_table[((crc >> 8) ^ *p++) & 0xFF]);
+	return crc;
+}
+
+typedef struct {
+	uint32_t n;			// bytes written to frame_enc
+	uint32_t code_at;	// where the current block's code byte goes
+	uint8_t code;
+} cobs_enc_t;
+
+static void cobs_begin(cobs_enc_t *e, uint32_t at)
+{
+	e->code_at = at;
+	e->n = at + 1;
+	e->code = 1;
+}
+
+static void cobs_put(cobs_enc_t *e, const uint8_t *p, uint32_t len)
+{
+	for (uint32_t i = 0; i < len; i++) {
+		if (p[i] == 0) {
+			frame_enc[e->code_at] = e->code;
+			cobs_begin(e, e->n);
+			continue;
+		}
+
+		frame_enc[e->n++] = p[i];
+		if (++e->code == 0xFF) {
+			frame_enc[e->code_at] = e->code;
+			cobs_begin(e, e->n);
+		}
+	}
+}
+
+int console_write_frame(const void *a, uint16_t alen, const void *b, uint16_t blen)
+{
+	uint8_t crc_le[2];
+	cobs_enc_t e;
+
+	if ((uint32_t)alen + blen + 2 > CONSOLE_FRAME_MAX)
+		return -1;
+
+	uint16_t crc = crc16_update(ADC_STREAM_CRC_INIT, a, alen);
+	crc = crc16_update(crc, b, blen);
+	crc_le[0] = (uint8_t)crc;
+	crc_le[1] = (uint8_t)(crc >> 8);
+
+	frame_enc[0] = 0x00;
+	cobs_begin(&e, 1);
+	cobs_put(&e, a, alen);
+	cobs_put(&e, b, blen);
+	cobs_put(&e, crc_le, 2);
+	frame_enc[e.code_at] = e.code;
+	frame_enc[e.n++] = 0x00;
+
+	if (e.n > console_tx_free())
+		return -1;
+
+	console_tx_put(frame_enc, e.n);
+	return (int)e.n;
+}
+
 static void console_write(const char *s) {
-	HAL_UART_Transmit(&huart2, (uint8_t*) s, strlen(s),
-	HAL_MAX_DELAY);
+	console_tx_put((const uint8_t*) s, strlen(s));
 }
 
 void console_printf(const char *fmt, ...)
 {
-    char buf[128];   // keep this reasonable
+    tx_writer_t w;
     va_list ap;
 
+    tx_writer_begin(&w);
     va_start(ap, fmt);
-    vsnprintf(buf, sizeof(buf), fmt, ap);
+    fmt_vprint(&w.sink, fmt, ap);
     va_end(ap);
-
-    console_write(buf);
+    tx_writer_end(&w);
 }
 
 static void console_prompt(void) {
-	HAL_UART_Transmit(&huart2, (uint8_t*) "> ", 2,
-	HAL_MAX_DELAY);
+	console_tx_put((const uint8_t*) "> ", 2);
 }
 
-static void console_handle_command(char *cmd) {
-	char *argv[8];
-	int argc = 0;
+void console_set_tx_policy(console_tx_policy_t p)
+{
+	if (p <= CONSOLE_TX_TRUNC)
+		tx_policy = p;
+}
 
-	char *token = strtok(cmd, " ");
-	while (token && argc < 8) {
-		argv[argc++] = token;
-		token = strtok(NULL, " ");
+console_tx_policy_t console_get_tx_policy(void)
+{
+	return tx_policy;
+}
+
+void console_get_tx_stats(console_tx_stats_t *out)
+{
+	*out = tx_stats;
+	out->level = tx_head - tx_tail;
+}
+
+void console_reset_tx_stats(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	memset(&tx_stats, 0, sizeof(tx_stats));
+	__set_PRIMASK(primask);
+}
+
+/*
+ * Baud switching. "baud <rate>" announces the new rate at the old one,
+ * waits for TX to drain, reprograms USART2 and then expects "baud ok"
+ * at the new rate within BAUD_ACK_TIMEOUT_MS, otherwise it falls back.
+ * "baud test" keeps the TX ring topped up from task_console and times
+ * how long the DMA takes to push the bytes out.
+ *
+ * The ADC stream is held and watches are skipped for the whole switch
+ * or test, so nothing else refills the ring. Every state has a time
+ * limit; a TX wait that outlives it (twice the ring's wire time plus
+ * BAUD_TX_SLACK_MS) gives up and returns to BAUD_IDLE with an error.
+ */
+#define BAUD_ACK_TIMEOUT_MS 2000
+#define BAUD_TX_SLACK_MS    100
+#define BAUD_MAX_ERR_PPM    20000UL	// 2%: both ends sample mid-bit
+#define BAUD_TEST_DEFAULT   16384
+#define BAUD_TEST_MAX       (1UL << 20)
+
+typedef enum {
+	BAUD_IDLE = 0,
+	BAUD_DRAIN,			// announced, waiting for TX to finish at the old rate
+	BAUD_WAIT_ACK,		// switched, waiting for "baud ok"
+	BAUD_REVERT,		// no ack, waiting for TX before going back
+	BAUD_TEST_DRAIN,	// waiting for TX so only the test bytes are timed
+	BAUD_TEST,
+} baud_state_t;
+
+static struct {
+	baud_state_t state;
+	uint32_t new_baud;
+	uint32_t old_baud;
+	uint32_t t_state;		// ms, when the current state was entered
+	uint32_t limit_ms;		// time allowed in the current state
+	uint32_t test_len;
+	uint32_t test_left;
+	uint64_t test_start;	// us, TIM2 wall time: DWT stops while we sleep
+	uint32_t test_us;
+} baud;
+
+static const char baud_test_line[64] =
+	"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz\r\n";	// no NUL
+
+static int console_tx_idle(void)
+{
+	return tx_head == tx_tail && tx_inflight == 0 &&
+	       __HAL_UART_GET_FLAG(&huart2, UART_FLAG_TC);
+}
+
+/* drop whatever arrived while the two ends disagreed on the rate */
+static void console_rx_discard(void)
+{
+	console_rx_advance();
+	rx_read = rx_written;
+	line_len = 0;
+	line_overflow = 0;
+}
+
+/* actual rate for baud, 0 if out of range or too far off */
+static uint32_t baud_check(uint32_t rate, uint32_t *err_ppm, uint8_t *over8)
+{
+	uint32_t brr;
+	uint32_t actual = usart2_baud_plan(rate, &brr, over8);
+
+	if (actual == 0)
+		return 0;
+
+	uint32_t diff = actual > rate ? actual - rate : rate - actual;
+	*err_ppm = (uint32_t)(((uint64_t)diff * 1000000U) / rate);
+
+	return *err_ppm <= BAUD_MAX_ERR_PPM ? actual : 0;
+}
+
+static void baud_test_fill(void)
+{
+	uint32_t n = console_tx_free();
+
+	if (n > baud.test_left)
+		n = baud.test_left;
+
+	while (n > 0) {
+		uint32_t off = (baud.test_len - baud.test_left) % sizeof(baud_test_line);
+		uint32_t k = sizeof(baud_test_line) - off;
+
+		if (k > n)
+			k = n;
+
+		console_tx_put((const uint8_t*) &baud_test_line[off], k);
+		baud.test_left -= k;
+		n -= k;
 	}
+}
 
-	if (argc == 0)
+static void baud_test_report(void)
+{
+	uint32_t us = baud.test_us;
+	uint32_t bps = us ? (uint32_t)(((uint64_t)baud.test_len * 1000000U) / us) : 0;
+	uint32_t link = huart2.Init.BaudRate / 10;		// 8N1: 10 bits per byte
+
+	console_printf("baud test: %lu B in %lu.%03lu ms = %lu B/s (link %lu B/s, %lu%%)\r\n",
+	               baud.test_len, us / 1000, us % 1000, bps, link,
+	               link ? (uint32_t)(((uint64_t)bps * 100U) / link) : 0);
+}
+
+/* generous time for bytes to leave at the current rate */
+static uint32_t baud_tx_ms(uint32_t bytes)
+{
+	uint64_t bits = (uint64_t)bytes * 10U;		// 8N1
+
+	return (uint32_t)((bits * 2000U) / huart2.Init.BaudRate) + BAUD_TX_SLACK_MS;
+}
+
+static void baud_enter(baud_state_t state, uint32_t limit_ms)
+{
+	baud.state = state;
+	baud.t_state = system_uptime_ms();
+	baud.limit_ms = limit_ms;
+}
+
+static int baud_expired(void)
+{
+	return system_uptime_ms() - baud.t_state >= baud.limit_ms;
+}
+
+/* leave the link to the switch or test: hold the stream, drain the ring */
+static void baud_begin(baud_state_t state)
+{
+	adc_stream_hold(1);
+	baud_enter(state, baud_tx_ms(UART_TX_BUF_SIZE));
+}
+
+static void baud_end(void)
+{
+	baud.state = BAUD_IDLE;
+	adc_stream_hold(0);
+}
+
+static void console_baud_poll(void)
+{
+	switch (baud.state) {
+	case BAUD_DRAIN:
+		if (!console_tx_idle()) {
+			if (!baud_expired())
+				return;
+
+			baud_end();
+			console_write("baud: TX did not drain, switch aborted\r\n");
+			console_prompt();
+			return;
+		}
+
+		usart2_set_baud(baud.new_baud);
+		console_rx_discard();
+		baud_enter(BAUD_WAIT_ACK, BAUD_ACK_TIMEOUT_MS);
+		console_printf("baud %lu?\r\n", baud.new_baud);
+		return;
+
+	case BAUD_WAIT_ACK:
+		if (baud_expired())
+			baud_enter(BAUD_REVERT, baud_tx_ms(UART_TX_BUF_SIZE));
 		return;
 
-	for (size_t i = 0; i < CMD_COUNT; i++) {
-		if (strcmp(argv[0], cmd_table[i].name) == 0) {
-			cmd_table[i].fn(argc, argv);
+	case BAUD_REVERT:
+		/* nobody is listening at this rate: past the limit, go back regardless */
+		if (!console_tx_idle() && !baud_expired())
+			return;
+
+		usart2_set_baud(baud.old_baud);
+		console_rx_discard();
+		baud_end();
+		console_printf("baud %lu not acknowledged, back to %lu\r\n",
+		               baud.new_baud, baud.old_baud);
+		console_prompt();
+		return;
+
+	case BAUD_TEST_DRAIN:
+		if (!console_tx_idle()) {
+			if (!baud_expired())
+				return;
+
+			baud_end();
+			console_write("baud test: TX did not drain, test aborted\r\n");
+			console_prompt();
+			return;
+		}
+
+		baud.test_start = system_uptime_us();
+		baud_enter(BAUD_TEST, baud_tx_ms(baud.test_len + UART_TX_BUF_SIZE));
+		baud_test_fill();
+		return;
+
+	case BAUD_TEST:
+		if (baud_expired()) {
+			baud_end();
+			console_printf("\r\nbaud test: timed out, %lu of %lu B queued\r\n",
+			               baud.test_len - baud.test_left, baud.test_len);
+			console_prompt();
 			return;
 		}
+		if (baud.test_left > 0) {
+			baud_test_fill();
+			return;
+		}
+		if (!console_tx_idle())
+			return;
+
+		baud.test_us = (uint32_t)(system_uptime_us() - baud.test_start);
+		baud_end();
+		baud_test_report();
+		console_write("ok\r\n");
+		console_prompt();
+		return;
+
+	default:
+		return;
 	}
+}
 
-	console_write("unknown command\r\n");
-	console_prompt();
+/* split in place on spaces; tokens are also NUL-terminated */
+static int console_tokenize(char *s, console_arg_t *argv, int max)
+{
+	int argc = 0;
+
+	while (argc < max) {
+		while (*s == ' ')
+			s++;
+		if (*s == '\0')
+			break;
+
+		argv[argc].p = s;
+		while (*s != '\0' && *s != ' ')
+			s++;
+		argv[argc].len = (uint8_t)(s - argv[argc].p);
+		argc++;
+
+		if (*s == '\0')
+			break;
+		*s++ = '\0';
+	}
+
+	return argc;
+}
+
+static int arg_cmp(const console_arg_t *a, const char *name)
+{
+	int c = strncmp(a->p, name, a->len);
+
+	if (c != 0)
+		return c;
+	return name[a->len] != '\0' ? -1 : 0;
+}
+
+static int arg_is(const console_arg_t *a, const char *s)
+{
+	return arg_cmp(a, s) == 0;
+}
+
+/* decimal only; rejects empty, trailing junk and overflow */
+static int arg_u32(const console_arg_t *a, uint32_t *out)
+{
+	uint32_t v = 0;
+
+	if (a->len == 0)
+		return -1;
+
+	for (uint8_t i = 0; i < a->len; i++) {
+		uint32_t d = (uint32_t)(a->p[i] - '0');
+
+		if (d > 9 || v > (UINT32_MAX - d) / 10)
+			return -1;
+		v = v * 10 + d;
+	}
+
+	*out = v;
+	return 0;
+}
+
+/* "250", "250ms", "2s", "1m" -> milliseconds */
+static int arg_period_ms(const console_arg_t *a, uint32_t *out)
+{
+	console_arg_t num = *a;
+	uint32_t scale = 1, v;
+
+	while (num.len > 0 && (num.p[num.len - 1] < '0' || num.p[num.len - 1] > '9'))
+		num.len--;
+
+	const char *unit = num.p + num.len;
+	uint8_t ulen = (uint8_t)(a->len - num.len);
+
+	if (ulen == 1 && unit[0] == 's')
+		scale = 1000;
+	else if (ulen == 1 && unit[0] == 'm')
+		scale = 60000;
+	else if (!(ulen == 0 || (ulen == 2 && unit[0] == 'm' && unit[1] == 's')))
+		return -1;
+
+	if (arg_u32(&num, &v) != 0 || v > UINT32_MAX / scale)
+		return -1;
+
+	*out = v * scale;
+	return 0;
+}
+
+static const console_cmd_t *cmd_lookup(const console_cmd_t *t, uint8_t n,
+		const console_arg_t *a)
+{
+	uint8_t lo = 0, hi = n;
+
+	while (lo < hi) {
+		uint8_t mid = (uint8_t)((lo + hi) / 2);
+		int c = arg_cmp(a, t[mid].name);
+
+		if (c == 0)
+			return &t[mid];
+		if (c < 0)
+			hi = mid;
+		else
+			lo = (uint8_t)(mid + 1);
+	}
+
+	return NULL;
+}
+
+static int cmd_table_sorted(const console_cmd_t *t, uint8_t n)
+{
+	for (uint8_t i = 0; i < n; i++) {
+		if (i > 0 && strcmp(t[i - 1].name, t[i].name) >= 0)
+			return 0;
+		if (t[i].sub && !cmd_table_sorted(t[i].sub, t[i].nsub))
+			return 0;
+	}
+	return 1;
+}
+
+static void cmd_usage(const console_cmd_t *c)
+{
+	console_write("usage: ");
+	console_write(c->name);
+	console_write(" ");
+	for (uint8_t i = 0; i < c->nsub; i++) {
+		if (i)
+			console_write("|");
+		console_write(c->sub[i].name);
+	}
+	console_write("\r\n");
+}
+
+static void console_handle_command(char *cmd) {
+	console_arg_t argv[CONSOLE_MAX_ARGS];
+	int argc = console_tokenize(cmd, argv, CONSOLE_MAX_ARGS);
+
+	if (argc == 0)
+		return;
+
+	/*
+	 * Mid-switch or mid-test we only listen for the ack, and for
+	 * "adc stream off" so the stream can always be stopped.
+	 */
+	if (baud.state != BAUD_IDLE &&
+	    !(argc == 2 && arg_is(&argv[0], "baud") && arg_is(&argv[1], "ok")) &&
+	    !(argc == 3 && arg_is(&argv[0], "adc") && arg_is(&argv[1], "stream") &&
+	      arg_is(&argv[2], "off")))
+		return;
+
+	const console_cmd_t *c = cmd_lookup(cmd_table, CMD_COUNT, &argv[0]);
+	int rc = CMD_ERR;
+
+	if (c == NULL) {
+		console_write("unknown command\r\n");
+	} else if (c->sub) {
+		const console_cmd_t *s = (argc >= 2) ? cmd_lookup(c->sub, c->nsub, &argv[1]) : NULL;
+
+		if (s)
+			rc = s->fn(argc - 1, argv + 1);
+		else if (c->fn)
+			rc = c->fn(argc, argv);
+		else
+			cmd_usage(c);
+	} else {
+		rc = c->fn(argc, argv);
+	}
+
+	if (rc == CMD_OK)
+		console_write("ok\r\n");
+	if (rc != CMD_PENDING)
+		console_prompt();
 }
 
 void console_init(void) {
+	crc16_init_table();
+
+	/* cmd_lookup bisects: an unsorted table is a build bug, stop here */
+	if (!cmd_table_sorted(cmd_table, CMD_COUNT)) {
+		static const char msg[] = "console: command table not sorted\r\n";
+
+		HAL_UART_Transmit(&huart2, (const uint8_t*) msg, sizeof(msg) - 1, 100);
+		Error_Handler();
+	}
+
 	HAL_UART_Receive_DMA(&huart2, uart_rx_dma_buf,
 	UART_RX_DMA_BUF_SIZE);
 
+	/*
+	 * With DMAR set, HAL treats any FE/NE/ORE as fatal and aborts the RX
+	 * stream, e.g. on one garbled byte during a baud switch. Keep the
+	 * error interrupt off; console_uart_irq samples the flags instead.
+	 */
+	ATOMIC_CLEAR_BIT(huart2.Instance->CR3, USART_CR3_EIE);
+
 	__HAL_UART_ENABLE_IT(&huart2, UART_IT_IDLE);
 
 	console_write("ok\r\n");
@@ -101,43 +881,215 @@ void console_init(void) {
 }
 
 void task_console(void) {
-	if (!rx_pending)
+	tx_hold = 1;
+
+	console_baud_poll();
+
+	if (baud.state == BAUD_IDLE)
+		watch_poll(system_uptime_ms());
+
+	console_rx_poll();		// cheap when nothing arrived
+
+	tx_hold = 0;
+	console_tx_flush();
+
+	console_schedule();
+}
+
+/*
+ * task_console has no period. RX and TX completions activate it, and
+ * otherwise it sleeps until the earliest thing it owes: the next watch
+ * line or the end of the current baud state's time limit. States that
+ * wait for the TX ring to drain are also woken by the TX-complete
+ * interrupt. Staged output needs no deadline, it is always flushed
+ * before we get here.
+ */
+static void console_schedule(void)
+{
+	uint32_t now = system_uptime_ms();
+	uint32_t due;
+
+	tx_wake = 0;
+
+	switch (baud.state) {
+	case BAUD_IDLE:
+		if (watch_next_due(&due) == 0) {
+			int32_t wait = (int32_t)(due - now);
+
+			task_wake_in(TASK_ID_CONSOLE, wait > 0 ? (uint32_t)wait * 1000u : 0);
+			return;
+		}
+		break;
+
+	case BAUD_WAIT_ACK:
+		break;
+
+	default:
+		tx_wake = 1;
+		__DMB();
+		if (console_tx_idle())		// already drained: no TX interrupt is coming
+			task_activate(TASK_ID_CONSOLE);
+		break;
+	}
+
+	if (baud.state == BAUD_IDLE) {
+		task_wake_cancel(TASK_ID_CONSOLE);
+		return;
+	}
+
+	uint32_t spent = now - baud.t_state;
+	uint32_t left = spent < baud.limit_ms ? baud.limit_ms - spent : 0;
+
+	if (left > 60000)		// a long test at a slow rate; re-armed on each pass
+		left = 60000;
+	task_wake_in(TASK_ID_CONSOLE, left * 1000u);
+}
+
+/* fold the DMA position into rx_written; ISR or thread */
+static void console_rx_advance(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	uint32_t pos = (UART_RX_DMA_BUF_SIZE - __HAL_DMA_GET_COUNTER(huart2.hdmarx))
+			& UART_RX_DMA_BUF_MASK;
+
+	rx_written += (pos - rx_dma_pos) & UART_RX_DMA_BUF_MASK;
+	rx_dma_pos = pos;
+
+	__set_PRIMASK(primask);
+}
+
+/* deferred from the IDLE interrupt with the SR it saw */
+static void console_rx_idle(uint32_t sr)
+{
+	if (sr & USART_SR_ORE)
+		rx_stats.ore++;
+	if (sr & USART_SR_FE)
+		rx_stats.fe++;
+	if (sr & USART_SR_NE)
+		rx_stats.ne++;
+
+	task_activate(TASK_ID_CONSOLE);
+}
+
+void console_uart_irq(void)
+{
+	uint32_t sr = huart2.Instance->SR;
+
+	if (sr & USART_SR_IDLE) {
+		__HAL_UART_CLEAR_IDLEFLAG(&huart2);		// SR then DR: clears the error flags too
+		(void)defer_post(console_rx_idle, sr);
+	}
+}
+
+/* advance here, not deferred, so a lap of the buffer is always seen twice */
+void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+	if (huart != &huart2)
 		return;
 
-	rx_pending = 0;
+	console_rx_advance();
+	task_activate(TASK_ID_CONSOLE);
+}
+
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+	if (huart != &huart2)
+		return;
+
+	console_rx_advance();
+	task_activate(TASK_ID_CONSOLE);
+}
+
+/* parse everything received so far, however many commands that is */
+static void console_rx_poll(void)
+{
+	console_rx_advance();
+
+	for (;;) {
+		uint32_t avail = rx_written - rx_read;
+
+		if (avail > rx_stats.high_water)
+			rx_stats.high_water = avail;
+
+		if (avail > UART_RX_DMA_BUF_SIZE) {
+			uint32_t lost = avail - UART_RX_DMA_BUF_SIZE;
+
+			/* what is left may be half overwritten too: resync at a line end */
+			rx_stats.overruns++;
+			rx_stats.lost_bytes += lost;
+			rx_read = rx_written;
+			line_len = 0;
+			line_overflow = 0;
+			line_skip = 1;
+			console_printf("rx overrun, %lu bytes lost\r\n", lost);
+			return;
+		}
+		if (avail == 0)
+			return;
+
+		/* one contiguous run; commands in it may take a while, so recheck */
+		uint32_t off = rx_read & UART_RX_DMA_BUF_MASK;
+		uint32_t n = avail;
 
-	uint16_t dma_pos =
-	UART_RX_DMA_BUF_SIZE - __HAL_DMA_GET_COUNTER(huart2.hdmarx);
+		if (n > UART_RX_DMA_BUF_SIZE - off)
+			n = UART_RX_DMA_BUF_SIZE - off;
 
-	if (dma_pos != dma_last_pos) {
-		if (dma_pos > dma_last_pos) {
-			console_process_bytes(&uart_rx_dma_buf[dma_last_pos],
-					dma_pos - dma_last_pos);
-		} else {
-			console_process_bytes(&uart_rx_dma_buf[dma_last_pos],
-			UART_RX_DMA_BUF_SIZE - dma_last_pos);
-			if (dma_pos > 0) {
-				console_process_bytes(&uart_rx_dma_buf[0], dma_pos);
-			}
-		}
-		dma_last_pos = dma_pos;
+		console_process_bytes(&uart_rx_dma_buf[off], (uint16_t)n);
+		rx_read += n;
+		rx_stats.bytes += n;
 	}
 }
 
+void console_get_rx_stats(console_rx_stats_t *out)
+{
+	*out = rx_stats;
+}
+
+void console_reset_rx_stats(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	memset(&rx_stats, 0, sizeof(rx_stats));
+	__set_PRIMASK(primask);
+}
+
 static void console_process_bytes(uint8_t *data, uint16_t len) {
 	for (uint16_t i = 0; i < len; i++) {
 		char c = data[i];
+		char prev = rx_last;
+
+		rx_last = c;
 
 		/* ENTER */
 		if (c == '\r' || c == '\n') {
-			HAL_UART_Transmit(&huart2, (uint8_t*) "\r\n", 2,
-			HAL_MAX_DELAY);
+			if (c == '\n' && prev == '\r')
+				continue;			// CRLF is one line end
 
-			if (line_len > 0) {
+			if (line_skip) {
+				line_skip = 0;
+				line_len = 0;
+				continue;
+			}
+
+			console_tx_put((const uint8_t*) "\r\n", 2);
+
+			if (line_overflow) {
+				rx_stats.long_lines++;
+				console_printf("line too long (max %u)\r\n", LINE_BUF_SIZE - 1);
+				console_prompt();
+			} else if (line_len > 0) {
 				line_buf[line_len] = '\0';
+				rx_stats.lines++;
 				console_handle_command(line_buf);
-				line_len = 0;
 			}
+			line_len = 0;
+			line_overflow = 0;
+		}
+
+		else if (line_skip) {
+			/* resyncing after an overrun */
 		}
 
 		/* BACKSPACE */
@@ -146,8 +1098,7 @@ static void console_process_bytes(uint8_t *data, uint16_t len) {
 				line_len--;
 
 				/* erase character on terminal */
-				HAL_UART_Transmit(&huart2, (uint8_t*) "\b \b", 3,
-				HAL_MAX_DELAY);
+				console_tx_put((const uint8_t*) "\b \b", 3);
 			}
 		}
 
@@ -157,157 +1108,721 @@ static void console_process_bytes(uint8_t *data, uint16_t len) {
 				line_buf[line_len++] = c;
 
 				/* echo */
-				HAL_UART_Transmit(&huart2, (uint8_t*) &c, 1,
-				HAL_MAX_DELAY);
+				console_tx_put((const uint8_t*) &c, 1);
 			} else {
-				/* optional: bell or ignore */
+				line_overflow = 1;	// never run a truncated command
 			}
 		}
 	}
 }
 
-static void cmd_status(int argc, char *argv[])
+static int cmd_status(int argc, const console_arg_t *argv)
 {
     (void)argc;
     (void)argv;
 
-    char buf[64];
+    console_printf("led=%s uptime=%lu ms\r\n",
+                   led_mode_str(led_get_mode()), system_uptime_ms());
 
-    snprintf(
-        buf,
-        sizeof(buf),
-        "led=%s uptime=%lu ms\r\n",
-        led_mode_str(led_get_mode()),
-        system_uptime_ms()
-    );
+	return CMD_OK;
+}
 
-    console_write(buf);
+static int cmd_adc_start(int argc, const console_arg_t *argv)
+{
+    (void)argc;
+    (void)argv;
 
-	console_write("ok\r\n");
-	console_prompt();
+    adc_app_start();
+    console_write("adc started\r\n");
+    return CMD_OK;
 }
 
-static void cmd_adc(int argc, char **argv)
+static int cmd_adc_stop(int argc, const console_arg_t *argv)
 {
-	if (argc < 2) {
-        console_write("usage: adc start|stop|volts|latest|avg|temp\r\n");
-        console_prompt();
-		return;
-	}
+    (void)argc;
+    (void)argv;
 
-    if (!strcmp(argv[1], "start"))
-    {
-        adc_app_start();
-        console_write("adc started\r\n");
+    adc_app_stop();
+    console_write("adc stopped\r\n");
+    return CMD_OK;
+}
+
+/* adc rate [hz] */
+static int cmd_adc_rate(int argc, const console_arg_t *argv)
+{
+    if (argc >= 2) {
+        uint32_t hz;
+
+        if (arg_u32(&argv[1], &hz) != 0 || adc_app_set_rate(hz) != 0) {
+            console_printf("rate must be %lu..%lu Hz\r\n",
+                           ADC_RATE_MIN_HZ, adc_app_max_rate());
+            return CMD_ERR;
+        }
     }
-    else if (!strcmp(argv[1], "stop"))
-    {
-        adc_app_stop();
-        console_write("adc stopped\r\n");
+
+    uint32_t mhz = adc_app_get_rate_mhz();
+
+    console_printf("ADC rate=%lu Hz  [actual %lu.%03lu Hz]\r\n",
+                   adc_app_get_rate(), mhz / 1000, mhz % 1000);
+    return CMD_OK;
+}
+
+/* adc stats [reset] */
+static int cmd_adc_stats(int argc, const console_arg_t *argv)
+{
+    adc_ring_stats_t st;
+
+    if (argc >= 2 && arg_is(&argv[1], "reset")) {
+        adc_app_stats_reset();
+        console_write("adc stats reset\r\n");
+        return CMD_OK;
     }
-    else if (!strcmp(argv[1], "volts"))
-    {
-        uint16_t raw = adc_app_average();
-        uint32_t mv = adc_to_voltage(raw);
 
-		console_printf("ADC volts=%lu mV\r\n", mv);
+    for (uint8_t i = 0; i < adc_app_ch_count(); i++) {
+        adc_stats_snapshot_t ss;
+
+        adc_app_stats_get(i, &ss);
+
+        uint32_t mean_x100 = (uint32_t)(ss.mean * 100.0f + 0.5f);
+        uint32_t sd_x100   = (uint32_t)(sqrtf(ss.var) * 100.0f + 0.5f);
+
+        console_printf("ch%u n=%llu min=%u max=%u last=%u mean=%.2lq sd=%.2lq\r\n",
+                       adc_app_ch_num(i), ss.count, ss.min, ss.max, ss.last,
+                       mean_x100, sd_x100);
     }
-    else if (!strcmp(argv[1], "latest"))
-    {
-		uint16_t raw = adc_read_avg(16);
-		uint32_t mv = (raw * 3300UL) / 4095;
 
-		console_printf("ADC latest=%u (raw) [%lu mV]\r\n", raw, mv);
+    adc_ring_get_stats(&st);
+
+    console_printf("blocks produced=%lu consumed=%lu dropped=%lu\r\n",
+                   st.produced, st.consumed, st.dropped);
+    console_printf("ring level=%lu/%u  gaps=%lu  frames lost=%lu\r\n",
+                   st.level, ADC_RING_SLOTS, adc_app_seq_gaps(),
+                   st.dropped * ADC_BLOCK_FRAMES);
+    return CMD_OK;
+}
+
+/* adc ch [add <n> [cycles] | del <n>] */
+static int cmd_adc_ch(int argc, const console_arg_t *argv)
+{
+    uint32_t ch, cycles = 84;
+    int rc = 0;
+
+    if (argc >= 3 && arg_is(&argv[1], "add") && arg_u32(&argv[2], &ch) == 0 &&
+        (argc < 4 || arg_u32(&argv[3], &cycles) == 0)) {
+        rc = (ch > 0xFF || cycles > 0xFFFF) ? ADC_CH_ERR_CHANNEL
+                                            : adc_app_ch_add((uint8_t)ch, (uint16_t)cycles);
+    } else if (argc >= 3 && arg_is(&argv[1], "del") && arg_u32(&argv[2], &ch) == 0) {
+        rc = ch > 0xFF ? ADC_CH_ERR_CHANNEL : adc_app_ch_remove((uint8_t)ch);
+    } else if (argc != 1) {
+        console_write("usage: adc ch [add <n> [3|15|28|56|84|112|144|480] | del <n>]\r\n");
+        return CMD_ERR;
     }
-    else if (!strcmp(argv[1], "avg"))
-    {
-        uint16_t raw = adc_app_average();
+
+    switch (rc) {
+    case 0:
+        break;
+    case ADC_CH_ERR_CHANNEL:
+        console_write("invalid channel\r\n");
+        return CMD_ERR;
+    case ADC_CH_ERR_SMP:
+        console_write("invalid sample time\r\n");
+        return CMD_ERR;
+    case ADC_CH_ERR_FULL:
+        console_write("sequence full\r\n");
+        return CMD_ERR;
+    case ADC_CH_ERR_RATE:
+        console_write("scan too long for current rate\r\n");
+        return CMD_ERR;
+    case ADC_CH_ERR_EMPTY:
+        console_write("cannot remove last channel\r\n");
+        return CMD_ERR;
+    default:
+        return CMD_ERR;
+    }
+
+    for (uint8_t i = 0; i < adc_app_ch_count(); i++) {
+        console_printf("rank %u: ch%u  %u cycles\r\n",
+                       i + 1, adc_app_ch_num(i), adc_app_ch_smp_cycles(i));
+    }
+    console_printf("max rate=%lu Hz\r\n", adc_app_max_rate());
+
+    return CMD_OK;
+}
+
+/* adc os [<ch> <0..4>] - oversample by 4^n, 12+n bit output */
+static int cmd_adc_os(int argc, const console_arg_t *argv)
+{
+    if (argc >= 3) {
+        uint32_t ch, bits;
+
+        if (arg_u32(&argv[1], &ch) != 0 || ch > 0xFF) {
+            console_write("invalid channel\r\n");
+            return CMD_ERR;
+        }
+        if (arg_u32(&argv[2], &bits) != 0 || bits > 0xFF) {
+            console_write("oversampling must be 0..4 (4^n)\r\n");
+            return CMD_ERR;
+        }
+
+        int rc = adc_app_os_set((uint8_t)ch, (uint8_t)bits);
+
+        if (rc == ADC_CH_ERR_CHANNEL) {
+            console_write("invalid channel\r\n");
+            return CMD_ERR;
+        }
+        if (rc == ADC_CH_ERR_OS) {
+            console_write("oversampling must be 0..4 (4^n)\r\n");
+            return CMD_ERR;
+        }
+    } else if (argc != 1) {
+        console_write("usage: adc os [<ch> <0..4>]\r\n");
+        return CMD_ERR;
+    }
+
+    uint32_t rate_mhz = adc_app_get_rate_mhz();
+
+    for (uint8_t i = 0; i < adc_app_ch_count(); i++) {
+        uint8_t  bits = adc_app_os_bits(i);
+        uint16_t out  = adc_app_os_latest(i);
+        uint32_t out_mhz = rate_mhz >> (2 * bits);
+        uint32_t mv = (out * 3300UL) / (4095UL << bits);
+
+        console_printf("ch%u os=%lux %u-bit  out=%lu.%03lu Hz  value=%u [%lu mV]\r\n",
+                       adc_app_ch_num(i), 1UL << (2 * bits), 12 + bits,
+                       out_mhz / 1000, out_mhz % 1000, out, mv);
+    }
+
+    return CMD_OK;
+}
+
+/* adc history <1s|10s|1m|1h> [ch] [n] - newest bucket first */
+static int cmd_adc_history(int argc, const console_arg_t *argv)
+{
+    adc_hist_bucket_t b;
+    int level = (argc >= 2) ? adc_history_level(argv[1].p) : -1;
+
+    if (level < 0) {
+        console_write("usage: adc history <1s|10s|1m|1h> [ch] [n]\r\n");
+        return CMD_ERR;
+    }
+
+    int idx = 0;
+    if (argc >= 3) {
+        uint32_t ch;
+
+        idx = (arg_u32(&argv[2], &ch) == 0 && ch <= 0xFF) ? adc_app_ch_find((uint8_t)ch) : -1;
+        if (idx < 0) {
+            console_write("channel not in sequence\r\n");
+            return CMD_ERR;
+        }
+    }
+
+    uint32_t n = 10;
+    if (argc >= 4 && arg_u32(&argv[3], &n) != 0) {
+        console_write("usage: adc history <1s|10s|1m|1h> [ch] [n]\r\n");
+        return CMD_ERR;
+    }
+    if (n > adc_history_level_len(level))
+        n = adc_history_level_len(level);
+
+    console_printf("ch%u history %s (newest first)\r\n",
+                   adc_app_ch_num(idx), adc_history_level_name(level));
+
+    for (uint32_t age = 0; age < n; age++) {
+        if (!adc_history_get(idx, level, age, &b))
+            break;
+
+        uint32_t mean = b.count ? (uint32_t)(b.sum / b.count) : 0;
+
+        console_printf("%2lu: min=%u max=%u mean=%lu n=%lu\r\n",
+                       age, b.min, b.max, mean, b.count);
+    }
+
+    return CMD_OK;
+}
+
+/* adc stream [on [rice]|off] */
+static int cmd_adc_stream(int argc, const console_arg_t *argv)
+{
+    if (argc > 1 && arg_is(&argv[1], "on")) {
+        adc_stream_set_rice(argc > 2 && arg_is(&argv[2], "rice"));
+        adc_stream_enable(1);
+    }
+    else if (argc > 1 && arg_is(&argv[1], "off"))
+        adc_stream_enable(0);
+    else if (argc > 1) {
+        console_write("usage: adc stream [on [rice]|off]\r\n");
+        return CMD_ERR;
+    }
+
+    adc_stream_stats_t st;
+    adc_stream_get_stats(&st);
+
+    console_printf("stream %s%s  packets=%lu dropped=%lu bytes=%lu\r\n",
+                   adc_stream_enabled() ? "on" : "off",
+                   adc_stream_rice() ? " (rice)" : "",
+                   st.packets, st.dropped, st.bytes);
+
+    if (adc_stream_rice() && st.sent_payload && st.enc_samples) {
+        uint32_t ratio_x100 = (uint32_t)(((uint64_t)st.raw_payload * 100) / st.sent_payload);
+        uint32_t cyc_x100   = (uint32_t)(((uint64_t)st.enc_cycles * 100) / st.enc_samples);
+
+        console_printf("ratio %.2lq:1  encode %.2lq cyc/sample\r\n",
+                       ratio_x100, cyc_x100);
+    }
+
+    console_printf("needs %lu B/s, link %lu B/s\r\n",
+                   adc_stream_wire_rate(), huart2.Init.BaudRate / 10);
+    return CMD_OK;
+}
+
+static int cmd_adc_bench(int argc, const console_arg_t *argv)
+{
+    (void)argc;
+    (void)argv;
+
+    adc_conv_bench_t b;
+
+    adc_conv_bench(&b);
+    console_printf("cyc/sample  scalar=%.2lq  mv_block=%.2lq  units_block=%.2lq\r\n",
+                   b.scalar_x100, b.mv_x100, b.units_x100);
+    console_printf("mv_block mismatches vs adc_to_voltage: %lu/4096\r\n", b.mismatches);
+    return CMD_OK;
+}
+
+static int cmd_adc_volts(int argc, const console_arg_t *argv)
+{
+    (void)argc;
+    (void)argv;
+
+    for (uint8_t i = 0; i < adc_app_ch_count(); i++) {
+        uint32_t mv = adc_to_voltage(adc_app_average(i));
+
+        console_printf("ADC ch%u volts=%lu mV\r\n", adc_app_ch_num(i), mv);
+    }
+    return CMD_OK;
+}
+
+static int cmd_adc_latest(int argc, const console_arg_t *argv)
+{
+    (void)argc;
+    (void)argv;
+
+    for (uint8_t i = 0; i < adc_app_ch_count(); i++) {
+        uint16_t raw;
+
+        if (!adc_app_snapshot(i, &raw, 1)) {
+            console_write("adc not running\r\n");
+            return CMD_ERR;
+        }
+
+        uint32_t mv = adc_to_voltage(raw);
+
+        console_printf("ADC ch%u latest=%u (raw) [%lu mV]\r\n",
+                       adc_app_ch_num(i), raw, mv);
+    }
+    return CMD_OK;
+}
+
+static int cmd_adc_avg(int argc, const console_arg_t *argv)
+{
+    (void)argc;
+    (void)argv;
+
+    for (uint8_t i = 0; i < adc_app_ch_count(); i++) {
+        uint16_t raw = adc_app_average(i);
         uint32_t mv = adc_to_voltage(raw);
 
-		console_printf("ADC avg=%u  [%lu mV]\r\n", raw, mv);
+        console_printf("ADC ch%u avg=%u  [%lu mV]\r\n",
+                       adc_app_ch_num(i), raw, mv);
+    }
+    return CMD_OK;
+}
+
+/* adc temp [check] */
+static int cmd_adc_temp(int argc, const console_arg_t *argv)
+{
+    int idx = adc_app_ch_find(ADC_NTC_CHANNEL);
+    uint16_t raw;
+
+    if (idx < 0) {
+        console_printf("ch%u not in sequence\r\n", ADC_NTC_CHANNEL);
+        return CMD_ERR;
     }
-    else if (!strcmp(argv[1], "temp"))
+
+    if (argc > 1 && arg_is(&argv[1], "check"))
     {
-		uint16_t raw = adc_read_avg(16);
+        ntc_report_t rep;
+
+        ntc_check(&rep);
+        console_printf("LUT max err=%.2lq C @ code %u  %.2lq cyc/sample\r\n",
+                       rep.max_err_cc, rep.worst_code, rep.cycles_x100);
+        return CMD_OK;
+    }
+
+    if (!adc_app_snapshot_mean(idx, 16, &raw)) {
+        console_write("adc not running\r\n");
+        return CMD_ERR;
+    }
+
+    int16_t cc = ntc_code_to_centi_c(raw);
+
+    if (cc == NTC_INVALID) {
+        console_printf("ADC=%u  TEMP ERROR (open/short)\r\n", raw);
+        return CMD_ERR;
+    }
+
+    console_printf("ADC=%u  Rntc=%lu ohm  Temp=%.2q C\r\n",
+                   raw, ntc_code_to_ohms(raw), cc);
+    return CMD_OK;
+}
+
+/* baud [<rate>] */
+static int cmd_baud(int argc, const console_arg_t *argv)
+{
+    uint32_t rate, err_ppm, actual;
+    uint8_t over8;
+
+    if (argc < 2) {
+        actual = baud_check(huart2.Init.BaudRate, &err_ppm, &over8);
+        console_printf("baud=%lu actual=%lu over%u\r\n",
+                       huart2.Init.BaudRate, actual, over8 ? 8 : 16);
+        return CMD_OK;
+    }
+
+    if (arg_u32(&argv[1], &rate) != 0) {
+        console_write("usage: baud [<rate>|list|test [bytes]]\r\n");
+        return CMD_ERR;
+    }
+
+    actual = baud_check(rate, &err_ppm, &over8);
+    if (actual == 0) {
+        console_printf("baud must be %lu..%lu within %lu.%lu%% (see baud list)\r\n",
+                       USART_BAUD_MIN, HAL_RCC_GetPCLK1Freq() / 8,
+                       BAUD_MAX_ERR_PPM / 10000, (BAUD_MAX_ERR_PPM / 1000) % 10);
+        return CMD_ERR;
+    }
+
+    baud.old_baud = huart2.Init.BaudRate;
+    baud.new_baud = rate;
+    baud_begin(BAUD_DRAIN);
+
+    console_printf("baud %lu (actual %lu, over%u): send \"baud ok\" within %u ms\r\n",
+                   rate, actual, over8 ? 8 : 16, BAUD_ACK_TIMEOUT_MS);
+    return CMD_PENDING;
+}
+
+static int cmd_baud_list(int argc, const console_arg_t *argv)
+{
+    (void)argc;
+    (void)argv;
+
+    static const uint32_t rates[] = {
+        115200, 230400, 460800, 921600, 1000000, 1500000,
+        2000000, 2625000, 3000000, 3500000, 4000000, 5250000,
+    };
+
+    for (uint8_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        uint32_t brr, err_ppm = 0;
+        uint8_t over8 = 0;
+        uint32_t actual = usart2_baud_plan(rates[i], &brr, &over8);
+
+        if (actual != 0)
+            baud_check(rates[i], &err_ppm, &over8);
+
+        console_printf("%8lu  actual=%7lu over%-2u err=%lu.%02lu%%%s\r\n",
+                       rates[i], actual, over8 ? 8 : 16,
+                       err_ppm / 10000, (err_ppm / 100) % 100,
+                       (actual && err_ppm <= BAUD_MAX_ERR_PPM) ? "" : "  (no)");
+    }
+    return CMD_OK;
+}
+
+static int cmd_baud_ok(int argc, const console_arg_t *argv)
+{
+    (void)argc;
+    (void)argv;
+
+    if (baud.state != BAUD_WAIT_ACK) {
+        console_write("no baud change pending\r\n");
+        return CMD_ERR;
+    }
+
+    baud_end();
+    console_printf("baud %lu ok\r\n", huart2.Init.BaudRate);
+    return CMD_OK;
+}
+
+/* baud test [bytes] */
+static int cmd_baud_test(int argc, const console_arg_t *argv)
+{
+    uint32_t n = BAUD_TEST_DEFAULT;
+
+    if (argc >= 2 && (arg_u32(&argv[1], &n) != 0 || n == 0 || n > BAUD_TEST_MAX)) {
+        console_printf("bytes must be 1..%lu\r\n", BAUD_TEST_MAX);
+        return CMD_ERR;
+    }
+
+    /* task_console starts the clock once the ring has drained */
+    baud.test_len = n;
+    baud.test_left = n;
+    baud_begin(BAUD_TEST_DRAIN);
+
+    return CMD_PENDING;
+}
+
+static int cmd_uart_bench(int argc, const console_arg_t *argv)
+{
+    (void)argc;
+    (void)argv;
+
+    fmt_bench_t b;
+
+    fmt_bench(&b);
+    console_printf("fmt %lu cyc/line (%lu chars)", b.fmt_cycles, b.line_len);
+    if (b.libc_cycles)
+        console_printf("  vsnprintf %lu cyc/line", b.libc_cycles);
+    console_write("\r\n");
+    return CMD_OK;
+}
+
+/* uart stats [reset] */
+static int cmd_uart_stats(int argc, const console_arg_t *argv)
+{
+    if (argc > 1 && arg_is(&argv[1], "reset")) {
+        console_reset_tx_stats();
+        console_reset_rx_stats();
+        console_write("uart stats reset\r\n");
+        return CMD_OK;
+    }
+
+    console_tx_stats_t st;
+    console_get_tx_stats(&st);
 
-        float temp_c = thermistor_beta_to_celsius(raw);
+    console_printf("tx policy=%s level=%lu/%u high=%lu\r\n",
+                   tx_policy_names[tx_policy], st.level,
+                   UART_TX_BUF_SIZE, st.high_water);
+    console_printf("tx queued=%lu sent=%lu dma=%lu\r\n",
+                   st.bytes_queued, st.bytes_sent, st.dma_xfers);
+    console_printf("tx blocked=%lu dropped=%lu (%lu B) truncated=%lu B\r\n",
+                   st.blocked, st.dropped_msgs, st.dropped_bytes,
+                   st.truncated_bytes);
+    console_printf("tx flushes=%lu early=%lu bytes/flush avg=%lu max=%lu\r\n",
+                   st.flushes, st.early_flushes,
+                   st.flushes ? st.flush_bytes / st.flushes : 0, st.flush_max);
 
-        if (!isfinite(temp_c)) {
-            console_printf("TEMP ERROR (NaN/Inf)\r\n");
-            return;
+    console_rx_stats_t rx;
+    console_get_rx_stats(&rx);
+
+    console_printf("rx bytes=%lu lines=%lu high=%lu/%u long=%lu\r\n",
+                   rx.bytes, rx.lines, rx.high_water, UART_RX_DMA_BUF_SIZE,
+                   rx.long_lines);
+    console_printf("rx overruns=%lu (%lu B lost) ore=%lu fe=%lu ne=%lu\r\n",
+                   rx.overruns, rx.lost_bytes, rx.ore, rx.fe, rx.ne);
+    return CMD_OK;
+}
+
+/* uart txpolicy [block|drop|trunc] */
+static int cmd_uart_txpolicy(int argc, const console_arg_t *argv)
+{
+    if (argc > 1) {
+        uint8_t p;
+
+        for (p = 0; p <= CONSOLE_TX_TRUNC; p++)
+            if (arg_is(&argv[1], tx_policy_names[p]))
+                break;
+
+        if (p > CONSOLE_TX_TRUNC) {
+            console_write("usage: uart txpolicy [block|drop|trunc]\r\n");
+            return CMD_ERR;
         }
+        console_set_tx_policy((console_tx_policy_t)p);
+    }
+
+    console_printf("tx policy=%s\r\n", tx_policy_names[tx_policy]);
+    return CMD_OK;
+}
+
+/* cycles -> us x100, so %.2lq prints two decimals */
+static uint32_t cyc_to_us_x100(uint64_t cyc)
+{
+    return (uint32_t)(cyc * 100u / timebase_cycles_per_us());
+}
 
-        float r_ntc = adc_to_ntc_resistance(raw, 10000.0f);
-        console_printf("ADC=%u  Rntc=%.0f ohm  Temp=%.2f C\r\n",
-                       raw, r_ntc, temp_c);
+/* tasks [reset] */
+static int cmd_tasks(int argc, const console_arg_t *argv)
+{
+    if (argc > 1 && arg_is(&argv[1], "reset")) {
+        task_reset_stats();
+        defer_reset_stats();
+        console_write("task stats reset\r\n");
+        return CMD_OK;
     }
-    else
-    {
-        console_write("unknown adc command\r\n");
+
+    uint64_t window = task_stats_window();
+    uint64_t window_cyc = window * timebase_cycles_per_us();
+    sched_stats_t ss;
+
+    sched_get_stats(&ss);
+
+    uint32_t secs = (uint32_t)(window / 1000000u);
+
+    console_printf("over %lu ms: passes=%lu activations=%lu wakeups=%lu (%lu/s) asleep=%.2lq%%\r\n",
+                   (uint32_t)(window / 1000u), ss.passes, ss.activations, ss.wakeups,
+                   secs ? ss.wakeups / secs : ss.wakeups,
+                   window ? (uint32_t)(ss.sleep_us * 10000u / window) : 0UL);
+    defer_stats_t ds;
+
+    defer_get_stats(&ds);
+    console_printf("defer posted=%lu run=%lu overflows=%lu high=%lu/%u\r\n",
+                   ds.posted, ds.run, ds.overflows, ds.high_water, DEFER_SLOTS);
+    console_write("run time in us, lateness in us past the due time\r\n");
+    console_write("task     period    calls   cpu%     avg     min     max    last  late min/avg/max\r\n");
+
+    for (uint8_t i = 0; i < task_count(); i++) {
+        const task_stats_t *s = task_get_stats(i);
+        uint32_t calls = s->calls;
+
+        console_printf("%-8s %4lu ms %8lu %6.2lq", s->name, s->period_ms, calls,
+                       window_cyc ? (uint32_t)(s->total_cyc * 10000u / window_cyc) : 0UL);
+
+        if (calls == 0) {
+            console_write("       -\r\n");
+            continue;
+        }
+
+        console_printf(" %7.2lq %7.2lq %7.2lq %7.2lq",
+                       cyc_to_us_x100(s->total_cyc / calls), cyc_to_us_x100(s->min_cyc),
+                       cyc_to_us_x100(s->max_cyc), cyc_to_us_x100(s->last_cyc));
+
+        if (s->timed != 0)
+            console_printf("  %ld/%ld/%ld\r\n", s->late_min_us,
+                           (int32_t)(s->late_sum_us / (int64_t)s->timed), s->late_max_us);
+        else
+            console_write("  -\r\n");
     }
 
-	console_write("ok\r\n");
-    console_prompt();
+    return CMD_OK;
+}
+
+/* watch [<metric> <period>] */
+static int cmd_watch(int argc, const console_arg_t *argv)
+{
+    if (argc >= 3) {
+        uint32_t ms;
+
+        if (arg_period_ms(&argv[2], &ms) != 0) {
+            console_write("usage: watch <metric> <period>[ms|s|m]\r\n");
+            return CMD_ERR;
+        }
+
+        switch (watch_add(argv[1].p, ms)) {
+        case 0:
+            break;
+        case WATCH_ERR_METRIC:
+            console_write("unknown metric:");
+            for (uint8_t i = 0; i < watch_metric_count(); i++)
+                console_printf(" %s", watch_metric_name(i));
+            console_write("\r\n");
+            return CMD_ERR;
+        case WATCH_ERR_PERIOD:
+            console_printf("period must be %u ms..%lu ms\r\n",
+                           WATCH_MIN_PERIOD_MS, WATCH_MAX_PERIOD_MS);
+            return CMD_ERR;
+        default:
+            console_printf("all %u watch slots in use\r\n", WATCH_SLOTS);
+            return CMD_ERR;
+        }
+    } else if (argc != 1) {
+        console_write("usage: watch <metric> <period>[ms|s|m]\r\n");
+        return CMD_ERR;
+    }
+
+    for (uint8_t i = 0; i < watch_count(); i++)
+        console_printf("%-10s every %lu ms  late=%lu\r\n",
+                       watch_name(i), watch_period(i), watch_late(i));
+    if (watch_count() == 0)
+        console_write("no watches\r\n");
+
+    return CMD_OK;
+}
+
+/* unwatch [metric] */
+static int cmd_unwatch(int argc, const console_arg_t *argv)
+{
+    uint8_t n = watch_remove(argc >= 2 ? argv[1].p : NULL);
+
+    if (argc >= 2 && n == 0) {
+        console_write("not watched\r\n");
+        return CMD_ERR;
+    }
+
+    console_printf("%u removed\r\n", n);
+    return CMD_OK;
 }
 
-static void cmd_led(int argc, char *argv[]) {
+static int cmd_led(int argc, const console_arg_t *argv) {
 	if (argc < 2) {
 		console_write("usage: led off|slow|fast\r\n");
-		console_prompt();
-		return;
+		return CMD_ERR;
 	}
 
-	if (strcmp(argv[1], "off") == 0) {
+	if (arg_is(&argv[1], "off")) {
 		led_set_mode(LED_MODE_OFF);
-	} else if (strcmp(argv[1], "slow") == 0) {
+	} else if (arg_is(&argv[1], "slow")) {
 		led_set_mode(LED_MODE_SLOW);
-	} else if (strcmp(argv[1], "fast") == 0) {
+	} else if (arg_is(&argv[1], "fast")) {
 		led_set_mode(LED_MODE_FAST);
 	} else {
 		console_write("invalid mode\r\n");
-		return;
+		return CMD_ERR;
 	}
 
-	console_write("ok\r\n");
-	console_prompt();
+	return CMD_OK;
 }
 
-static void cmd_help(int argc, char *argv[]) {
-	(void) argc;
-	(void) argv;
+/* help [cmd] */
+static int cmd_help(int argc, const console_arg_t *argv) {
+	if (argc >= 2) {
+		const console_cmd_t *c = cmd_lookup(cmd_table, CMD_COUNT, &argv[1]);
+
+		if (c == NULL || c->sub == NULL) {
+			console_write("no subcommands\r\n");
+			return CMD_ERR;
+		}
+
+		for (uint8_t i = 0; i < c->nsub; i++) {
+			console_write(c->name);
+			console_write(" ");
+			console_write(c->sub[i].name);
+			console_write(c->sub[i].help);
+			console_write("\r\n");
+		}
+		return CMD_DONE;
+	}
 
-	for (size_t i = 0; i < CMD_COUNT; i++) {
+	for (uint8_t i = 0; i < CMD_COUNT; i++) {
 		console_write(cmd_table[i].name);
 		console_write(cmd_table[i].help);
 		console_write("\r\n");
 	}
 
-	console_prompt();
+	return CMD_DONE;
 }
 
-static void cmd_uptime(int argc, char *argv[])
+static int cmd_uptime(int argc, const console_arg_t *argv)
 {
     (void)argc;
     (void)argv;
 
-    uint32_t ms = system_uptime_ms();
-
-    char buf[32];
+    uint64_t us = system_uptime_us();
 
-    uint32_t sec = ms / 1000;
+    uint32_t sec = (uint32_t)(us / 1000000u);
     uint32_t min = sec / 60;
     uint32_t hr  = min / 60;
 
-    snprintf(
-        buf,
-        sizeof(buf),
-        "%lu:%02lu:%02lu\r\n",
-        hr,
-        min % 60,
-        sec % 60
-    );
+    console_printf("%lu:%02lu:%02lu.%06lu (%llu us)\r\n",
+                   hr, min % 60, sec % 60, (uint32_t)(us % 1000000u), us);
 
-    console_write(buf);
-
-	console_prompt();
+	return CMD_DONE;
 }
@@ -0,0 +1,133 @@
+#include "defer.h"
+#include "main.h"
+
+/*
+ * A slot is free for position pos when seq == lap (pos & ~DEFER_MASK),
+ * holds an item when seq == lap + 1, and is handed to the next lap by
+ * setting seq = lap + DEFER_SLOTS. Zeroed RAM is therefore a valid
+ * empty queue.
+ */
+typedef struct {
+    volatile uint32_t seq;
+    defer_fn_t fn;
+    uint32_t arg;
+} defer_slot_t;
+
+static defer_slot_t slots[DEFER_SLOTS];
+static volatile uint32_t head;          // next position to claim, any ISR
+static volatile uint32_t tail;          // next position to run, main loop
+
+static volatile uint32_t overflows;
+static volatile uint32_t high_water;
+static uint32_t run_count;
+static uint32_t posted_base;            // head at the last stats reset
+
+static void atomic_inc(volatile uint32_t *p)
+{
+    uint32_t v;
+
+    do {
+        v = __LDREXW(p);
+    } while (__STREXW(v + 1, p) != 0);
+}
+
+static void atomic_max(volatile uint32_t *p, uint32_t n)
+{
+    uint32_t v;
+
+    do {
+        v = __LDREXW(p);
+        if (n <= v) {
+            __CLREX();
+            return;
+        }
+    } while (__STREXW(n, p) != 0);
+}
+
+int defer_post(defer_fn_t fn, uint32_t arg)
+{
+    uint32_t pos;
+    defer_slot_t *s;
+
+    /*
+     * seq ahead of this lap: a nested ISR claimed and published pos after
+     * our LDREX, so head has moved on; claim again. seq behind: the slot
+     * still holds the previous lap's item, so the queue is full.
+     */
+    for (;;) {
+        pos = __LDREXW(&head);
+        s = &slots[pos & DEFER_MASK];
+
+        int32_t d = (int32_t)(s->seq - (pos & ~DEFER_MASK));
+
+        if (d < 0) {
+            __CLREX();
+            atomic_inc(&overflows);
+            return -1;
+        }
+        if (d > 0) {
+            __CLREX();
+            continue;
+        }
+        if (__STREXW(pos + 1, &head) == 0)
+            break;
+    }
+
+    s->fn = fn;
+    s->arg = arg;
+    __DMB();
+    s->seq = (pos & ~DEFER_MASK) + 1;
+
+    atomic_max(&high_water, pos + 1 - tail);
+    task_activate(TASK_ID_DEFER);
+    return 0;
+}
+
+uint32_t defer_run(void)
+{
+    uint32_t n = 0;
+
+    for (;;) {
+        uint32_t pos = tail;
+        defer_slot_t *s = &slots[pos & DEFER_MASK];
+        uint32_t lap = pos & ~DEFER_MASK;
+
+        if (s->seq != lap + 1)
+            break;                          // empty
+
+        __DMB();
+        defer_fn_t fn = s->fn;
+        uint32_t arg = s->arg;
+
+        __DMB();
+        s->seq = lap + DEFER_SLOTS;         // free for the next lap
+        tail = pos + 1;
+
+        fn(arg);
+        n++;
+    }
+
+    run_count += n;
+    return n;
+}
+
+void task_defer(void)
+{
+    (void)defer_run();
+}
+
+void defer_get_stats(defer_stats_t *st)
+{
+    st->posted = head - posted_base;
+    st->run = run_count;
+    st->overflows = overflows;
+    st->high_water = high_water;
+}
+
+void defer_reset_stats(void)
+{
+    posted_base = head;
+    run_count = 0;
+    overflows = 0;
+    high_water = 0;
+}
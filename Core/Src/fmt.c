@@ -0,0 +1,297 @@
+#include "fmt.h"
+#include "cycles.h"
+#include <string.h>
+
+#ifdef FMT_BENCH_LIBC
+#include <stdio.h>      // only for the comparison; normal builds never link printf
+#endif
+
+#define FMT_BENCH_ROUNDS 32
+#define FMT_BENCH_LINE   "ch%u n=%lu min=%u max=%u last=%u mean=%lu.%02lu sd=%lu.%02lu\r\n"
+
+// exactly 16 chars each, no NUL needed
+static const char fmt_spaces[16] = "                ";
+static const char fmt_zeros[16]  = "0000000000000000";
+static const char fmt_hex_lc[16] = "0123456789abcdef";
+static const char fmt_hex_uc[16] = "0123456789ABCDEF";
+
+static void fmt_pad(fmt_sink_t *s, const char *fill, uint32_t n)
+{
+    while (n > 0) {
+        uint32_t k = n < 16 ? n : 16;
+
+        s->put(s, fill, k);
+        n -= k;
+    }
+}
+
+/* digits are written backwards, ending just before `end`; returns the first */
+static char *fmt_u32(char *end, uint32_t v)
+{
+    do {
+        *--end = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+
+    return end;
+}
+
+static char *fmt_u64(char *end, uint64_t v)
+{
+    // one 64-bit divide per nine digits, the rest stays in 32-bit
+    while (v > UINT32_MAX) {
+        uint64_t q = v / 1000000000U;
+        uint32_t r = (uint32_t)(v - q * 1000000000U);
+
+        for (uint8_t i = 0; i < 9; i++) {
+            *--end = (char)('0' + r % 10);
+            r /= 10;
+        }
+        v = q;
+    }
+
+    return fmt_u32(end, (uint32_t)v);
+}
+
+/* v / 10^frac with exactly frac decimals, so 5 with frac 2 is "0.05" */
+static char *fmt_dec(char *end, uint64_t v, uint32_t frac)
+{
+    char *p = end;
+
+    for (; frac > 0; frac--) {
+        *--p = (char)('0' + v % 10);
+        v /= 10;
+    }
+    if (p != end)
+        *--p = '.';
+
+    return v <= UINT32_MAX ? fmt_u32(p, (uint32_t)v) : fmt_u64(p, v);
+}
+
+static char *fmt_hex(char *end, uint64_t v, const char *digits)
+{
+    do {
+        *--end = digits[v & 0xF];
+        v >>= 4;
+    } while (v);
+
+    return end;
+}
+
+void fmt_vprint(fmt_sink_t *s, const char *fmt, va_list ap)
+{
+    char buf[24];       // 20 digits of a u64, the point, slack
+
+    while (*fmt != '\0') {
+        const char *lit = fmt;
+
+        while (*fmt != '\0' && *fmt != '%')
+            fmt++;
+        if (fmt != lit)
+            s->put(s, lit, (uint32_t)(fmt - lit));
+        if (*fmt == '\0')
+            break;
+        fmt++;
+
+        uint8_t left = 0, zero = 0, lmod = 0;      // lmod: 0 int, 1 long, 2 long long
+        uint32_t width = 0, prec = 0;
+        uint8_t has_prec = 0;
+
+        for (;; fmt++) {
+            if (*fmt == '-')
+                left = 1;
+            else if (*fmt == '0')
+                zero = 1;
+            else
+                break;
+        }
+
+        if (*fmt == '*') {
+            int w = va_arg(ap, int);
+
+            if (w < 0) {
+                left = 1;
+                w = -w;
+            }
+            width = (uint32_t)w;
+            fmt++;
+        }
+        while (*fmt >= '0' && *fmt <= '9')
+            width = width * 10 + (uint32_t)(*fmt++ - '0');
+
+        if (*fmt == '.') {
+            has_prec = 1;
+            fmt++;
+            if (*fmt == '*') {
+                int pr = va_arg(ap, int);
+
+                prec = pr > 0 ? (uint32_t)pr : 0;
+                fmt++;
+            }
+            while (*fmt >= '0' && *fmt <= '9')
+                prec = prec * 10 + (uint32_t)(*fmt++ - '0');
+        }
+
+        if (fmt[0] == 'l' && fmt[1] == 'l') {
+            lmod = 2;
+            fmt += 2;
+        } else if (*fmt == 'l' || *fmt == 'z') {
+            lmod = 1;
+            fmt++;
+        } else if (*fmt == 'h') {
+            fmt++;                                  // promoted to int anyway
+        }
+
+        char *end = buf + sizeof(buf);
+        const char *p;
+        uint32_t len;
+        char sign = 0;
+
+        switch (*fmt) {
+        case 'd':
+        case 'i':
+        case 'q': {
+            int64_t v = lmod == 2 ? va_arg(ap, long long)
+                      : lmod == 1 ? va_arg(ap, long) : va_arg(ap, int);
+            uint64_t m = v < 0 ? 0 - (uint64_t)v : (uint64_t)v;
+
+            if (v < 0)
+                sign = '-';
+            if (prec > 18)
+                prec = 18;
+            p = fmt_dec(end, m, *fmt == 'q' ? prec : 0);
+            len = (uint32_t)(end - p);
+            break;
+        }
+
+        case 'u':
+        case 'x':
+        case 'X': {
+            uint64_t v = lmod == 2 ? va_arg(ap, unsigned long long)
+                       : lmod == 1 ? va_arg(ap, unsigned long) : va_arg(ap, unsigned int);
+
+            if (*fmt == 'u')
+                p = fmt_dec(end, v, 0);
+            else
+                p = fmt_hex(end, v, *fmt == 'x' ? fmt_hex_lc : fmt_hex_uc);
+            len = (uint32_t)(end - p);
+            break;
+        }
+
+        case 'c':
+            buf[0] = (char)va_arg(ap, int);
+            p = buf;
+            len = 1;
+            zero = 0;
+            break;
+
+        case 's':
+            p = va_arg(ap, const char *);
+            if (p == NULL)
+                p = "(null)";
+            for (len = 0; p[len] != '\0' && (!has_prec || len < prec); len++)
+                ;
+            zero = 0;
+            break;
+
+        case '\0':
+            return;
+
+        default:                                    // "%%" and anything unknown
+            p = fmt;
+            len = 1;
+            zero = 0;
+            break;
+        }
+        fmt++;
+
+        uint32_t used = len + (sign ? 1 : 0);
+        uint32_t pad = width > used ? width - used : 0;
+
+        if (!left && !zero)
+            fmt_pad(s, fmt_spaces, pad);
+        if (sign)
+            s->put(s, &sign, 1);
+        if (!left && zero)
+            fmt_pad(s, fmt_zeros, pad);
+        s->put(s, p, len);
+        if (left)
+            fmt_pad(s, fmt_spaces, pad);
+    }
+}
+
+void fmt_print(fmt_sink_t *s, const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    fmt_vprint(s, fmt, ap);
+    va_end(ap);
+}
+
+typedef struct {
+    fmt_sink_t sink;
+    char *buf;
+    uint32_t size;
+    uint32_t len;
+} fmt_buf_t;
+
+static void fmt_buf_put(fmt_sink_t *s, const char *p, uint32_t n)
+{
+    fmt_buf_t *b = (fmt_buf_t *)s;
+
+    if (b->len + 1 < b->size) {
+        uint32_t room = b->size - 1 - b->len;
+
+        memcpy(&b->buf[b->len], p, n < room ? n : room);
+    }
+    b->len += n;
+}
+
+uint32_t fmt_vsnprintf(char *buf, uint32_t size, const char *fmt, va_list ap)
+{
+    fmt_buf_t b = { { fmt_buf_put }, buf, size, 0 };
+
+    fmt_vprint(&b.sink, fmt, ap);
+
+    if (size > 0)
+        buf[b.len < size ? b.len : size - 1] = '\0';
+    return b.len;
+}
+
+uint32_t fmt_snprintf(char *buf, uint32_t size, const char *fmt, ...)
+{
+    va_list ap;
+    uint32_t n;
+
+    va_start(ap, fmt);
+    n = fmt_vsnprintf(buf, size, fmt, ap);
+    va_end(ap);
+    return n;
+}
+
+/* a typical "adc stats" line, written to RAM so the UART doesn't count */
+void fmt_bench(fmt_bench_t *r)
+{
+    char line[96];
+    uint32_t t0 = cycles_now();
+
+    for (uint32_t i = 0; i < FMT_BENCH_ROUNDS; i++)
+        r->line_len = fmt_snprintf(line, sizeof(line), FMT_BENCH_LINE,
+                                   (unsigned)(i & 7), 123456UL + i, 873u, 1012u, 940u,
+                                   941UL, 37UL, 12UL, 5UL);
+
+    r->fmt_cycles = (cycles_now() - t0) / FMT_BENCH_ROUNDS;
+
+#ifdef FMT_BENCH_LIBC
+    t0 = cycles_now();
+    for (uint32_t i = 0; i < FMT_BENCH_ROUNDS; i++)
+        snprintf(line, sizeof(line), FMT_BENCH_LINE,
+                 (unsigned)(i & 7), 123456UL + i, 873u, 1012u, 940u,
+                 941UL, 37UL, 12UL, 5UL);
+
+    r->libc_cycles = (cycles_now() - t0) / FMT_BENCH_ROUNDS;
+#else
+    r->libc_cycles = 0;
+#endif
+}
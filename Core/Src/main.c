@@ -28,6 +28,9 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "console.h"
+#include "cycles.h"
+#include "timebase.h"
+#include "defer.h"
 
 /* USER CODE END Includes */
 
@@ -46,14 +49,16 @@ typedef struct {
 	uint32_t timestamp_ms;
 } button_db_t;
 
-volatile button_db_t button = { 0 };
+button_db_t button = { 0 };		// task context only; the EXTI posts to it
 
 typedef void (*task_fn_t)(void);
 
 typedef struct {
 	task_fn_t fn;
-	uint32_t period_ms;
-	uint32_t last_run_ms;
+	uint32_t period_ms;		// 0: activated or woken by task_wake_in
+	uint32_t next_us;		// due time, timebase_now_us() scale
+	uint8_t heap_pos;		// SCHED_UNQUEUED when not due at all
+	task_stats_t stats;
 } task_t;
 
 /* USER CODE END PTD */
@@ -61,7 +66,8 @@ typedef struct {
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
 #define DEBOUNCE_MS 50
-#define TASK_COUNT 4
+#define US_PER_MS 1000u
+#define SCHED_UNQUEUED 0xFF
 
 /* USER CODE END PD */
 
@@ -73,8 +79,6 @@ typedef struct {
 /* Private variables ---------------------------------------------------------*/
 
 /* USER CODE BEGIN PV */
-volatile uint32_t system_tick_ms = 0;
-
 led_ctrl_t led = { .mode = LED_MODE_SLOW, .last_toggle_ms = 0, .interval_ms =
 		500, .led_on = 0 };
 
@@ -89,17 +93,45 @@ void task_led(void);
 void task_button(void);
 void task_idle(void);
 void task_console(void);
+static void sched_init(void);
+static void sched_run_due(void);
+static void sched_run_ready(void);
+static void task_run(task_t *t);
 
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
-task_t tasks[TASK_COUNT] = { { task_button, 10, 0 },   // 10 ms
-		{ task_led, 1, 0 },   // 1 ms
-		{ task_console, 5, 0 },   // 5 ms
-		{ task_idle, 0, 0 }    // always
+#define TASK(fn, name, ms) { fn, ms, 0, SCHED_UNQUEUED, { name, ms } }
+
+task_t tasks[TASK_COUNT] = {
+		[TASK_ID_ADC] = TASK(task_adc, "adc", 0),   // on DMA half-blocks
+		[TASK_ID_DEFER] = TASK(task_defer, "defer", 0),   // on defer_post
+		[TASK_ID_CONSOLE] = TASK(task_console, "console", 0),   // on RX/TX, at its next watch or baud deadline
+		[TASK_ID_BUTTON] = TASK(task_button, "button", 0),   // on EXTI, then at the debounce deadline
+		[TASK_ID_LED] = TASK(task_led, "led", 0),   // at the next blink edge; on mode change
+		[TASK_ID_IDLE] = TASK(task_idle, "idle", 0)    // every pass, last: sleeps until the next due time
 };
 
+/*
+ * Ready mask: ISRs set a task's bit with task_activate, the main loop
+ * takes the whole mask at the top of each pass and runs those tasks
+ * lowest bit first, ahead of anything periodic. task_idle won't sleep
+ * while a bit is set.
+ */
+static volatile uint32_t sched_ready;
+
+/*
+ * Tasks with a due time (periodic, or one-shot from task_wake_in) sit in
+ * a min-heap on next_us, so a pass only looks at the ones that are due
+ * and task_idle knows exactly how long it may sleep.
+ */
+static uint8_t sched_heap[TASK_COUNT];
+static uint8_t sched_heap_len;
+
+static sched_stats_t sched_stats;
+static uint64_t task_stats_since;
+
 /* USER CODE END 0 */
 
 /**
@@ -135,12 +167,14 @@ int main(void)
   MX_TIM2_Init();
   MX_USART2_UART_Init();
   MX_ADC1_Init();
+  MX_TIM3_Init();
   /* USER CODE BEGIN 2 */
 
+	timebase_init();
+	task_reset_stats();
 	console_init();
 	adc_app_init();
-
-	HAL_TIM_Base_Start_IT(&htim2);
+	sched_init();
 
   /* USER CODE END 2 */
 
@@ -150,15 +184,10 @@ int main(void)
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
-		uint32_t now = system_tick_ms;
-
-		for (int i = 0; i < TASK_COUNT; i++) {
-			if (tasks[i].period_ms == 0
-					|| (now - tasks[i].last_run_ms) >= tasks[i].period_ms) {
-				tasks[i].last_run_ms = now;
-				tasks[i].fn();
-			}
-		}
+		sched_stats.passes++;
+		sched_run_ready();
+		sched_run_due();
+		task_run(&tasks[TASK_ID_IDLE]);
 
 	}
   /* USER CODE END 3 */
@@ -211,27 +240,28 @@ void SystemClock_Config(void)
 }
 
 /* USER CODE BEGIN 4 */
-void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
-	if (GPIO_Pin == B1_Pin) {
-		if (!button.pending) {
-			button.pending = 1;
-			button.timestamp_ms = system_tick_ms;
-		}
+static void button_on_edge(uint32_t arg) {
+	(void)arg;
+
+	if (!button.pending) {
+		button.pending = 1;
+		button.timestamp_ms = system_uptime_ms();
+		task_wake_in(TASK_ID_BUTTON, DEBOUNCE_MS * US_PER_MS);
 	}
 }
 
-void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim) {
-	if (htim->Instance == TIM2) {
-		system_tick_ms++;
-	}
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+	if (GPIO_Pin == B1_Pin)
+		(void)defer_post(button_on_edge, GPIO_Pin);
 }
 
 uint32_t system_uptime_ms(void) {
-	return system_tick_ms;
+	return (uint32_t)(system_uptime_us() / US_PER_MS);
 }
 
 void led_set_mode(led_mode_t mode) {
 	led.mode = mode;
+	task_activate(TASK_ID_LED);
 }
 
 led_mode_t led_get_mode(void) {
@@ -280,19 +310,32 @@ void led_update(led_ctrl_t *ctrl, uint32_t now_ms) {
 
 uint8_t button_debounce_update(void) {
 	if (button.pending) {
-		if ((system_tick_ms - button.timestamp_ms) >= DEBOUNCE_MS) {
+		uint32_t held = system_uptime_ms() - button.timestamp_ms;
+
+		if (held >= DEBOUNCE_MS) {
 			button.pending = 0;
 
 			if (HAL_GPIO_ReadPin(B1_GPIO_Port, B1_Pin) == GPIO_PIN_RESET) {
 				return 1;  // Valid press
 			}
+		} else {
+			task_wake_in(TASK_ID_BUTTON, (DEBOUNCE_MS - held) * US_PER_MS);
 		}
 	}
 	return 0;
 }
 
+/* runs at each blink edge; a mode change activates it to re-plan */
 void task_led(void) {
-	led_update(&led, system_tick_ms);
+	uint32_t now = system_uptime_ms();
+
+	led_update(&led, now);
+
+	if (led.mode == LED_MODE_OFF)
+		task_wake_cancel(TASK_ID_LED);
+	else
+		task_wake_in(TASK_ID_LED,
+				(led.last_toggle_ms + led.interval_ms - now) * US_PER_MS);
 }
 
 void task_button(void) {
@@ -301,11 +344,239 @@ void task_button(void) {
 		if (led.mode > LED_MODE_FAST) {
 			led.mode = LED_MODE_OFF;
 		}
+		task_activate(TASK_ID_LED);
+	}
+}
+
+static int sched_before(uint8_t a, uint8_t b) {
+	return (int32_t)(tasks[a].next_us - tasks[b].next_us) < 0;
+}
+
+static void sched_swap(uint8_t i, uint8_t j) {
+	uint8_t a = sched_heap[i], b = sched_heap[j];
+
+	sched_heap[i] = b;
+	sched_heap[j] = a;
+	tasks[b].heap_pos = i;
+	tasks[a].heap_pos = j;
+}
+
+static void sched_sift_up(uint8_t i) {
+	while (i > 0) {
+		uint8_t p = (uint8_t)((i - 1) / 2);
+
+		if (!sched_before(sched_heap[i], sched_heap[p]))
+			return;
+		sched_swap(i, p);
+		i = p;
+	}
+}
+
+static void sched_sift_down(uint8_t i) {
+	for (;;) {
+		uint8_t l = (uint8_t)(2 * i + 1), r = (uint8_t)(l + 1), m = i;
+
+		if (l < sched_heap_len && sched_before(sched_heap[l], sched_heap[m]))
+			m = l;
+		if (r < sched_heap_len && sched_before(sched_heap[r], sched_heap[m]))
+			m = r;
+		if (m == i)
+			return;
+
+		sched_swap(i, m);
+		i = m;
 	}
 }
 
+static void sched_insert(uint8_t id) {
+	uint8_t i = sched_heap_len++;
+
+	sched_heap[i] = id;
+	tasks[id].heap_pos = i;
+	sched_sift_up(i);
+}
+
+static void sched_remove(uint8_t id) {
+	uint8_t i = tasks[id].heap_pos;
+	uint8_t last = --sched_heap_len;
+
+	tasks[id].heap_pos = SCHED_UNQUEUED;
+	if (i == last)
+		return;
+
+	uint8_t moved = sched_heap[last];
+
+	sched_heap[i] = moved;
+	tasks[moved].heap_pos = i;
+	sched_sift_up(i);
+	sched_sift_down(tasks[moved].heap_pos);
+}
+
+/* due in `us` from now, replacing any earlier due time; not for ISRs */
+void task_wake_in(task_id_t id, uint32_t us) {
+	task_t *t = &tasks[id];
+
+	t->next_us = timebase_now_us() + us;
+	if (t->heap_pos == SCHED_UNQUEUED) {
+		sched_insert((uint8_t)id);
+	} else {
+		sched_sift_up(t->heap_pos);
+		sched_sift_down(t->heap_pos);
+	}
+}
+
+void task_wake_cancel(task_id_t id) {
+	if (tasks[id].heap_pos != SCHED_UNQUEUED)
+		sched_remove((uint8_t)id);
+}
+
+/* LDREX/STREX: a retry, never a lost bit, if an ISR lands in between */
+void task_activate(task_id_t id) {
+	uint32_t bit = 1u << id;
+	uint32_t v;
+
+	do {
+		v = __LDREXW(&sched_ready);
+	} while (__STREXW(v | bit, &sched_ready) != 0);
+}
+
+static uint32_t sched_take_ready(void) {
+	uint32_t v;
+
+	do {
+		v = __LDREXW(&sched_ready);
+	} while (__STREXW(0, &sched_ready) != 0);
+
+	return v;
+}
+
+static void sched_run_ready(void) {
+	uint32_t ready = sched_take_ready();
+
+	while (ready != 0) {
+		uint32_t id = __CLZ(__RBIT(ready));
+
+		ready &= ready - 1;
+		sched_stats.activations++;
+		task_run(&tasks[id]);
+	}
+}
+
+static void sched_init(void) {
+	for (uint8_t i = 0; i < TASK_COUNT; i++) {
+		if (tasks[i].period_ms != 0)
+			task_wake_in((task_id_t)i, tasks[i].period_ms * US_PER_MS);
+	}
+	task_activate(TASK_ID_LED);		// plans its first blink edge
+	task_activate(TASK_ID_CONSOLE);
+}
+
+/*
+ * Run every task that is due, earliest first. It leaves the heap before
+ * it runs, so a one-shot task may re-arm itself with task_wake_in. A
+ * periodic one keeps its phase; if it fell a whole period behind, the
+ * missed runs are dropped rather than run back to back.
+ */
+static void sched_run_due(void) {
+	while (sched_heap_len > 0) {
+		uint8_t id = sched_heap[0];
+		task_t *t = &tasks[id];
+		uint32_t now = timebase_now_us();
+		int32_t late = (int32_t)(now - t->next_us);
+
+		if (late < 0)
+			return;
+
+		task_stats_t *s = &t->stats;
+
+		s->timed++;
+		if (late < s->late_min_us)
+			s->late_min_us = late;
+		if (late > s->late_max_us)
+			s->late_max_us = late;
+		s->late_sum_us += late;
+
+		sched_remove(id);
+		task_run(t);
+
+		if (t->period_ms == 0 || t->heap_pos != SCHED_UNQUEUED)
+			continue;
+
+		uint32_t period_us = t->period_ms * US_PER_MS;
+
+		t->next_us += period_us;
+		now = timebase_now_us();
+		if ((int32_t)(now - t->next_us) >= 0)
+			t->next_us += ((now - t->next_us) / period_us + 1) * period_us;
+
+		sched_insert(id);
+	}
+}
+
+/* Dispatch one task and account for its run time */
+static void task_run(task_t *t) {
+	task_stats_t *s = &t->stats;
+	uint32_t start = cycles_now();
+
+	t->fn();
+
+	uint32_t dt = cycles_now() - start;
+
+	s->calls++;
+	s->total_cyc += dt;
+	s->last_cyc = dt;
+	if (dt < s->min_cyc)
+		s->min_cyc = dt;
+	if (dt > s->max_cyc)
+		s->max_cyc = dt;
+}
+
+uint8_t task_count(void) {
+	return TASK_COUNT;
+}
+
+const task_stats_t* task_get_stats(uint8_t i) {
+	return i < TASK_COUNT ? &tasks[i].stats : NULL;
+}
+
+uint64_t task_stats_window(void) {
+	return system_uptime_us() - task_stats_since;
+}
+
+void sched_get_stats(sched_stats_t *st) {
+	*st = sched_stats;
+}
+
+void task_reset_stats(void) {
+	for (int i = 0; i < TASK_COUNT; i++) {
+		task_stats_t *s = &tasks[i].stats;
+
+		s->calls = 0;
+		s->total_cyc = 0;
+		s->min_cyc = UINT32_MAX;
+		s->max_cyc = 0;
+		s->last_cyc = 0;
+		s->timed = 0;
+		s->late_min_us = INT32_MAX;
+		s->late_max_us = INT32_MIN;
+		s->late_sum_us = 0;
+	}
+	sched_stats.passes = 0;
+	sched_stats.wakeups = 0;
+	sched_stats.activations = 0;
+	sched_stats.sleep_us = 0;
+	task_stats_since = system_uptime_us();
+}
+
 void task_idle(void) {
-	__WFI();  // Sleep until next interrupt
+	uint32_t wake = sched_heap_len > 0 ? tasks[sched_heap[0]].next_us
+			: timebase_now_us() + TIMEBASE_MAX_SLEEP_US;
+	uint32_t slept = timebase_sleep_until(wake, &sched_ready);
+
+	if (slept != 0) {
+		sched_stats.wakeups++;
+		sched_stats.sleep_us += slept;
+	}
 }
 
 /* USER CODE END 4 */
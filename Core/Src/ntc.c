@@ -0,0 +1,62 @@
+#include "ntc.h"
+#include "adc_app.h"
+#include "cycles.h"
+
+#define NTC_BENCH_LEN    32
+#define NTC_BENCH_ROUNDS 64
+
+void ntc_convert_block(const uint16_t *raw, int16_t *out, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+        out[i] = ntc_table[raw[i] & (NTC_ADC_CODES - 1)];
+}
+
+uint32_t ntc_code_to_ohms(uint16_t raw)
+{
+    if (raw == 0)
+        return 0;
+    if (raw >= NTC_ADC_CODES - 1)
+        return UINT32_MAX;
+
+    // 10000 * 4094 still fits in 32 bits
+    return ((uint32_t)NTC_R_PULLUP_OHM * raw) / (NTC_ADC_CODES - 1 - raw);
+}
+
+/*
+ * Compare every table entry against the float reference and time the
+ * block converter. Runs for a few ms; console use only.
+ */
+void ntc_check(ntc_report_t *rep)
+{
+    static uint16_t in[NTC_BENCH_LEN];
+    static int16_t out[NTC_BENCH_LEN];
+
+    rep->max_err_cc = 0;
+    rep->worst_code = 0;
+
+    for (uint16_t code = 1; code < NTC_ADC_CODES - 1; code++)
+    {
+        float ref = thermistor_beta_to_celsius(code) * 100.0f;
+
+        if (ref >= INT16_MAX || ref <= NTC_INVALID)
+            continue;                       // clamped by design
+
+        float d = (float)ntc_table[code] - ref;
+        int32_t err = (int32_t)((d < 0.0f ? -d : d) + 0.5f);
+
+        if (err > rep->max_err_cc) {
+            rep->max_err_cc = err;
+            rep->worst_code = code;
+        }
+    }
+
+    for (uint32_t i = 0; i < NTC_BENCH_LEN; i++)
+        in[i] = (uint16_t)(i * 127u + 1u);
+
+    uint32_t t0 = cycles_now();
+    for (uint32_t r = 0; r < NTC_BENCH_ROUNDS; r++)
+        ntc_convert_block(in, out, NTC_BENCH_LEN);
+    uint32_t dt = cycles_now() - t0;
+
+    rep->cycles_x100 = (dt * 100u) / (NTC_BENCH_LEN * NTC_BENCH_ROUNDS);
+}
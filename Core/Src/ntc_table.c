@@ -0,0 +1,526 @@
+/*
+ * ntc_table.c
+ *
+ * GENERATED by tools/gen_ntc_table.py from Core/Inc/ntc.h - do not edit.
+ *
+ * R_PULLUP=10000  R0=2200  BETA=3950  T0=25 C
+ * max |table - reference| = 0.500 centi-degC (code 2413)
+ */
+
+#include "ntc.h"
+
+const int16_t ntc_table[NTC_ADC_CODES] =
+{
+    -32768,  32767,  28018,  25042,  23118,  21719,  20632,  19750,   /*    0 */
+     19012,  18379,  17828,  17340,  16904,  16510,  16152,  15823,   /*    8 */
+     15520,  15239,  14977,  14733,  14503,  14287,  14084,  13891,   /*   16 */
+     13707,  13533,  13367,  13209,  13057,  12912,  12772,  12638,   /*   24 */
+     12509,  12385,  12265,  12150,  12038,  11930,  11825,  11724,   /*   32 */
+     11626,  11530,  11437,  11347,  11259,  11174,  11091,  11010,   /*   40 */
+     10931,  10854,  10778,  10705,  10633,  10563,  10494,  10427,   /*   48 */
+     10361,  10297,  10234,  10172,  10111,  10052,   9994,   9936,   /*   56 */
+      9880,   9825,   9771,   9718,   9666,   9614,   9564,   9514,   /*   64 */
+      9466,   9418,   9370,   9324,   9278,   9233,   9188,   9145,   /*   72 */
+      9102,   9059,   9017,   8976,   8935,   8895,   8855,   8816,   /*   80 */
+      8778,   8740,   8702,   8665,   8628,   8592,   8557,   8521,   /*   88 */
+      8487,   8452,   8418,   8385,   8351,   8319,   8286,   8254,   /*   96 */
+      8222,   8191,   8160,   8129,   8099,   8069,   8039,   8010,   /*  104 */
+      7981,   7952,   7923,   7895,   7867,   7839,   7812,   7785,   /*  112 */
+      7758,   7731,   7705,   7679,   7653,   7628,   7602,   7577,   /*  120 */
+      7552,   7527,   7503,   7479,   7454,   7431,   7407,   7384,   /*  128 */
+      7360,   7337,   7314,   7292,   7269,   7247,   7225,   7203,   /*  136 */
+      7181,   7159,   7138,   7117,   7096,   7075,   7054,   7033,   /*  144 */
+      7013,   6993,   6972,   6952,   6933,   6913,   6893,   6874,   /*  152 */
+      6855,   6835,   6816,   6797,   6779,   6760,   6742,   6723,   /*  160 */
+      6705,   6687,   6669,   6651,   6633,   6616,   6598,   6581,   /*  168 */
+      6563,   6546,   6529,   6512,   6495,   6478,   6462,   6445,   /*  176 */
+      6429,   6412,   6396,   6380,   6364,   6348,   6332,   6316,   /*  184 */
+      6301,   6285,   6270,   6254,   6239,   6224,   6208,   6193,   /*  192 */
+      6178,   6164,   6149,   6134,   6119,   6105,   6090,   6076,   /*  200 */
+      6062,   6047,   6033,   6019,   6005,   5991,   5977,   5963,   /*  208 */
+      5950,   5936,   5922,   5909,   5896,   5882,   5869,   5856,   /*  216 */
+      5842,   5829,   5816,   5803,   5790,   5778,   5765,   5752,   /*  224 */
+      5739,   5727,   5714,   5702,   5689,   5677,   5665,   5652,   /*  232 */
+      5640,   5628,   5616,   5604,   5592,   5580,   5568,   5556,   /*  240 */
+      5545,   5533,   5521,   5510,   5498,   5486,   5475,   5464,   /*  248 */
+      5452,   5441,   5430,   5419,   5407,   5396,   5385,   5374,   /*  256 */
+      5363,   5352,   5341,   5331,   5320,   5309,   5298,   5288,   /*  264 */
+      5277,   5267,   5256,   5246,   5235,   5225,   5214,   5204,   /*  272 */
+      5194,   5183,   5173,   5163,   5153,   5143,   5133,   5123,   /*  280 */
+      5113,   5103,   5093,   5083,   5073,   5064,   5054,   5044,   /*  288 */
+      5035,   5025,   5015,   5006,   4996,   4987,   4977,   4968,   /*  296 */
+      4959,   4949,   4940,   4931,   4921,   4912,   4903,   4894,   /*  304 */
+      4885,   4876,   4866,   4857,   4848,   4839,   4831,   4822,   /*  312 */
+      4813,   4804,   4795,   4786,   4778,   4769,   4760,   4751,   /*  320 */
+      4743,   4734,   4726,   4717,   4709,   4700,   4692,   4683,   /*  328 */
+      4675,   4666,   4658,   4650,   4641,   4633,   4625,   4617,   /*  336 */
+      4608,   4600,   4592,   4584,   4576,   4568,   4560,   4552,   /*  344 */
+      4544,   4536,   4528,   4520,   4512,   4504,   4496,   4488,   /*  352 */
+      4481,   4473,   4465,   4457,   4450,   4442,   4434,   4427,   /*  360 */
+      4419,   4411,   4404,   4396,   4389,   4381,   4374,   4366,   /*  368 */
+      4359,   4351,   4344,   4337,   4329,   4322,   4315,   4307,   /*  376 */
+      4300,   4293,   4285,   4278,   4271,   4264,   4257,   4250,   /*  384 */
+      4242,   4235,   4228,   4221,   4214,   4207,   4200,   4193,   /*  392 */
+      4186,   4179,   4172,   4165,   4158,   4152,   4145,   4138,   /*  400 */
+      4131,   4124,   4117,   4111,   4104,   4097,   4090,   4084,   /*  408 */
+      4077,   4070,   4064,   4057,   4051,   4044,   4037,   4031,   /*  416 */
+      4024,   4018,   4011,   4005,   3998,   3992,   3985,   3979,   /*  424 */
+      3972,   3966,   3960,   3953,   3947,   3941,   3934,   3928,   /*  432 */
+      3922,   3915,   3909,   3903,   3897,   3890,   3884,   3878,   /*  440 */
+      3872,   3866,   3859,   3853,   3847,   3841,   3835,   3829,   /*  448 */
+      3823,   3817,   3811,   3805,   3799,   3793,   3787,   3781,   /*  456 */
+      3775,   3769,   3763,   3757,   3751,   3745,   3739,   3734,   /*  464 */
+      3728,   3722,   3716,   3710,   3704,   3699,   3693,   3687,   /*  472 */
+      3681,   3676,   3670,   3664,   3658,   3653,   3647,   3641,   /*  480 */
+      3636,   3630,   3625,   3619,   3613,   3608,   3602,   3597,   /*  488 */
+      3591,   3586,   3580,   3574,   3569,   3563,   3558,   3553,   /*  496 */
+      3547,   3542,   3536,   3531,   3525,   3520,   3515,   3509,   /*  504 */
+      3504,   3498,   3493,   3488,   3482,   3477,   3472,   3466,   /*  512 */
+      3461,   3456,   3451,   3445,   3440,   3435,   3430,   3424,   /*  520 */
+      3419,   3414,   3409,   3404,   3399,   3393,   3388,   3383,   /*  528 */
+      3378,   3373,   3368,   3363,   3358,   3353,   3347,   3342,   /*  536 */
+      3337,   3332,   3327,   3322,   3317,   3312,   3307,   3302,   /*  544 */
+      3297,   3292,   3287,   3282,   3277,   3273,   3268,   3263,   /*  552 */
+      3258,   3253,   3248,   3243,   3238,   3233,   3229,   3224,   /*  560 */
+      3219,   3214,   3209,   3205,   3200,   3195,   3190,   3185,   /*  568 */
+      3181,   3176,   3171,   3166,   3162,   3157,   3152,   3148,   /*  576 */
+      3143,   3138,   3133,   3129,   3124,   3120,   3115,   3110,   /*  584 */
+      3106,   3101,   3096,   3092,   3087,   3083,   3078,   3073,   /*  592 */
+      3069,   3064,   3060,   3055,   3051,   3046,   3042,   3037,   /*  600 */
+      3033,   3028,   3024,   3019,   3015,   3010,   3006,   3001,   /*  608 */
+      2997,   2992,   2988,   2983,   2979,   2975,   2970,   2966,   /*  616 */
+      2961,   2957,   2953,   2948,   2944,   2940,   2935,   2931,   /*  624 */
+      2927,   2922,   2918,   2914,   2909,   2905,   2901,   2896,   /*  632 */
+      2892,   2888,   2884,   2879,   2875,   2871,   2867,   2862,   /*  640 */
+      2858,   2854,   2850,   2845,   2841,   2837,   2833,   2829,   /*  648 */
+      2825,   2820,   2816,   2812,   2808,   2804,   2800,   2795,   /*  656 */
+      2791,   2787,   2783,   2779,   2775,   2771,   2767,   2763,   /*  664 */
+      2759,   2754,   2750,   2746,   2742,   2738,   2734,   2730,   /*  672 */
+      2726,   2722,   2718,   2714,   2710,   2706,   2702,   2698,   /*  680 */
+      2694,   2690,   2686,   2682,   2678,   2674,   2670,   2666,   /*  688 */
+      2662,   2658,   2655,   2651,   2647,   2643,   2639,   2635,   /*  696 */
+      2631,   2627,   2623,   2619,   2616,   2612,   2608,   2604,   /*  704 */
+      2600,   2596,   2592,   2589,   2585,   2581,   2577,   2573,   /*  712 */
+      2569,   2566,   2562,   2558,   2554,   2550,   2547,   2543,   /*  720 */
+      2539,   2535,   2532,   2528,   2524,   2520,   2517,   2513,   /*  728 */
+      2509,   2505,   2502,   2498,   2494,   2491,   2487,   2483,   /*  736 */
+      2479,   2476,   2472,   2468,   2465,   2461,   2457,   2454,   /*  744 */
+      2450,   2446,   2443,   2439,   2435,   2432,   2428,   2425,   /*  752 */
+      2421,   2417,   2414,   2410,   2407,   2403,   2399,   2396,   /*  760 */
+      2392,   2389,   2385,   2381,   2378,   2374,   2371,   2367,   /*  768 */
+      2364,   2360,   2357,   2353,   2350,   2346,   2342,   2339,   /*  776 */
+      2335,   2332,   2328,   2325,   2321,   2318,   2314,   2311,   /*  784 */
+      2307,   2304,   2301,   2297,   2294,   2290,   2287,   2283,   /*  792 */
+      2280,   2276,   2273,   2269,   2266,   2263,   2259,   2256,   /*  800 */
+      2252,   2249,   2246,   2242,   2239,   2235,   2232,   2229,   /*  808 */
+      2225,   2222,   2218,   2215,   2212,   2208,   2205,   2202,   /*  816 */
+      2198,   2195,   2192,   2188,   2185,   2182,   2178,   2175,   /*  824 */
+      2172,   2168,   2165,   2162,   2158,   2155,   2152,   2148,   /*  832 */
+      2145,   2142,   2139,   2135,   2132,   2129,   2125,   2122,   /*  840 */
+      2119,   2116,   2112,   2109,   2106,   2103,   2099,   2096,   /*  848 */
+      2093,   2090,   2086,   2083,   2080,   2077,   2074,   2070,   /*  856 */
+      2067,   2064,   2061,   2058,   2054,   2051,   2048,   2045,   /*  864 */
+      2042,   2038,   2035,   2032,   2029,   2026,   2023,   2019,   /*  872 */
+      2016,   2013,   2010,   2007,   2004,   2001,   1997,   1994,   /*  880 */
+      1991,   1988,   1985,   1982,   1979,   1976,   1973,   1969,   /*  888 */
+      1966,   1963,   1960,   1957,   1954,   1951,   1948,   1945,   /*  896 */
+      1942,   1939,   1935,   1932,   1929,   1926,   1923,   1920,   /*  904 */
+      1917,   1914,   1911,   1908,   1905,   1902,   1899,   1896,   /*  912 */
+      1893,   1890,   1887,   1884,   1881,   1878,   1875,   1872,   /*  920 */
+      1869,   1866,   1863,   1860,   1857,   1854,   1851,   1848,   /*  928 */
+      1845,   1842,   1839,   1836,   1833,   1830,   1827,   1824,   /*  936 */
+      1821,   1818,   1815,   1812,   1809,   1806,   1803,   1800,   /*  944 */
+      1797,   1794,   1791,   1789,   1786,   1783,   1780,   1777,   /*  952 */
+      1774,   1771,   1768,   1765,   1762,   1759,   1757,   1754,   /*  960 */
+      1751,   1748,   1745,   1742,   1739,   1736,   1733,   1731,   /*  968 */
+      1728,   1725,   1722,   1719,   1716,   1713,   1710,   1708,   /*  976 */
+      1705,   1702,   1699,   1696,   1693,   1691,   1688,   1685,   /*  984 */
+      1682,   1679,   1676,   1674,   1671,   1668,   1665,   1662,   /*  992 */
+      1659,   1657,   1654,   1651,   1648,   1645,   1643,   1640,   /* 1000 */
+      1637,   1634,   1631,   1629,   1626,   1623,   1620,   1618,   /* 1008 */
+      1615,   1612,   1609,   1606,   1604,   1601,   1598,   1595,   /* 1016 */
+      1593,   1590,   1587,   1584,   1582,   1579,   1576,   1573,   /* 1024 */
+      1571,   1568,   1565,   1562,   1560,   1557,   1554,   1552,   /* 1032 */
+      1549,   1546,   1543,   1541,   1538,   1535,   1533,   1530,   /* 1040 */
+      1527,   1524,   1522,   1519,   1516,   1514,   1511,   1508,   /* 1048 */
+      1506,   1503,   1500,   1498,   1495,   1492,   1490,   1487,   /* 1056 */
+      1484,   1482,   1479,   1476,   1474,   1471,   1468,   1466,   /* 1064 */
+      1463,   1460,   1458,   1455,   1452,   1450,   1447,   1444,   /* 1072 */
+      1442,   1439,   1437,   1434,   1431,   1429,   1426,   1423,   /* 1080 */
+      1421,   1418,   1416,   1413,   1410,   1408,   1405,   1403,   /* 1088 */
+      1400,   1397,   1395,   1392,   1390,   1387,   1384,   1382,   /* 1096 */
+      1379,   1377,   1374,   1372,   1369,   1366,   1364,   1361,   /* 1104 */
+      1359,   1356,   1353,   1351,   1348,   1346,   1343,   1341,   /* 1112 */
+      1338,   1336,   1333,   1330,   1328,   1325,   1323,   1320,   /* 1120 */
+      1318,   1315,   1313,   1310,   1308,   1305,   1303,   1300,   /* 1128 */
+      1298,   1295,   1292,   1290,   1287,   1285,   1282,   1280,   /* 1136 */
+      1277,   1275,   1272,   1270,   1267,   1265,   1262,   1260,   /* 1144 */
+      1257,   1255,   1252,   1250,   1247,   1245,   1242,   1240,   /* 1152 */
+      1237,   1235,   1232,   1230,   1228,   1225,   1223,   1220,   /* 1160 */
+      1218,   1215,   1213,   1210,   1208,   1205,   1203,   1200,   /* 1168 */
+      1198,   1195,   1193,   1191,   1188,   1186,   1183,   1181,   /* 1176 */
+      1178,   1176,   1173,   1171,   1169,   1166,   1164,   1161,   /* 1184 */
+      1159,   1156,   1154,   1152,   1149,   1147,   1144,   1142,   /* 1192 */
+      1139,   1137,   1135,   1132,   1130,   1127,   1125,   1123,   /* 1200 */
+      1120,   1118,   1115,   1113,   1111,   1108,   1106,   1103,   /* 1208 */
+      1101,   1099,   1096,   1094,   1091,   1089,   1087,   1084,   /* 1216 */
+      1082,   1080,   1077,   1075,   1072,   1070,   1068,   1065,   /* 1224 */
+      1063,   1061,   1058,   1056,   1053,   1051,   1049,   1046,   /* 1232 */
+      1044,   1042,   1039,   1037,   1035,   1032,   1030,   1028,   /* 1240 */
+      1025,   1023,   1021,   1018,   1016,   1014,   1011,   1009,   /* 1248 */
+      1007,   1004,   1002,   1000,    997,    995,    993,    990,   /* 1256 */
+       988,    986,    983,    981,    979,    976,    974,    972,   /* 1264 */
+       969,    967,    965,    963,    960,    958,    956,    953,   /* 1272 */
+       951,    949,    946,    944,    942,    940,    937,    935,   /* 1280 */
+       933,    930,    928,    926,    924,    921,    919,    917,   /* 1288 */
+       914,    912,    910,    908,    905,    903,    901,    898,   /* 1296 */
+       896,    894,    892,    889,    887,    885,    883,    880,   /* 1304 */
+       878,    876,    874,    871,    869,    867,    865,    862,   /* 1312 */
+       860,    858,    856,    853,    851,    849,    847,    844,   /* 1320 */
+       842,    840,    838,    835,    833,    831,    829,    827,   /* 1328 */
+       824,    822,    820,    818,    815,    813,    811,    809,   /* 1336 */
+       807,    804,    802,    800,    798,    795,    793,    791,   /* 1344 */
+       789,    787,    784,    782,    780,    778,    776,    773,   /* 1352 */
+       771,    769,    767,    765,    762,    760,    758,    756,   /* 1360 */
+       754,    751,    749,    747,    745,    743,    741,    738,   /* 1368 */
+       736,    734,    732,    730,    727,    725,    723,    721,   /* 1376 */
+       719,    717,    714,    712,    710,    708,    706,    704,   /* 1384 */
+       701,    699,    697,    695,    693,    691,    688,    686,   /* 1392 */
+       684,    682,    680,    678,    676,    673,    671,    669,   /* 1400 */
+       667,    665,    663,    661,    658,    656,    654,    652,   /* 1408 */
+       650,    648,    646,    643,    641,    639,    637,    635,   /* 1416 */
+       633,    631,    629,    626,    624,    622,    620,    618,   /* 1424 */
+       616,    614,    612,    609,    607,    605,    603,    601,   /* 1432 */
+       599,    597,    595,    592,    590,    588,    586,    584,   /* 1440 */
+       582,    580,    578,    576,    574,    571,    569,    567,   /* 1448 */
+       565,    563,    561,    559,    557,    555,    553,    550,   /* 1456 */
+       548,    546,    544,    542,    540,    538,    536,    534,   /* 1464 */
+       532,    530,    528,    525,    523,    521,    519,    517,   /* 1472 */
+       515,    513,    511,    509,    507,    505,    503,    501,   /* 1480 */
+       499,    496,    494,    492,    490,    488,    486,    484,   /* 1488 */
+       482,    480,    478,    476,    474,    472,    470,    468,   /* 1496 */
+       466,    464,    461,    459,    457,    455,    453,    451,   /* 1504 */
+       449,    447,    445,    443,    441,    439,    437,    435,   /* 1512 */
+       433,    431,    429,    427,    425,    423,    421,    419,   /* 1520 */
+       417,    414,    412,    410,    408,    406,    404,    402,   /* 1528 */
+       400,    398,    396,    394,    392,    390,    388,    386,   /* 1536 */
+       384,    382,    380,    378,    376,    374,    372,    370,   /* 1544 */
+       368,    366,    364,    362,    360,    358,    356,    354,   /* 1552 */
+       352,    350,    348,    346,    344,    342,    340,    338,   /* 1560 */
+       336,    334,    332,    330,    328,    326,    324,    322,   /* 1568 */
+       320,    318,    316,    314,    312,    310,    308,    306,   /* 1576 */
+       304,    302,    300,    298,    296,    294,    292,    290,   /* 1584 */
+       288,    286,    284,    282,    280,    278,    276,    274,   /* 1592 */
+       272,    270,    268,    266,    264,    262,    260,    258,   /* 1600 */
+       256,    254,    253,    251,    249,    247,    245,    243,   /* 1608 */
+       241,    239,    237,    235,    233,    231,    229,    227,   /* 1616 */
+       225,    223,    221,    219,    217,    215,    213,    211,   /* 1624 */
+       209,    207,    205,    204,    202,    200,    198,    196,   /* 1632 */
+       194,    192,    190,    188,    186,    184,    182,    180,   /* 1640 */
+       178,    176,    174,    172,    170,    168,    167,    165,   /* 1648 */
+       163,    161,    159,    157,    155,    153,    151,    149,   /* 1656 */
+       147,    145,    143,    141,    139,    138,    136,    134,   /* 1664 */
+       132,    130,    128,    126,    124,    122,    120,    118,   /* 1672 */
+       116,    114,    112,    111,    109,    107,    105,    103,   /* 1680 */
+       101,     99,     97,     95,     93,     91,     89,     88,   /* 1688 */
+        86,     84,     82,     80,     78,     76,     74,     72,   /* 1696 */
+        70,     68,     67,     65,     63,     61,     59,     57,   /* 1704 */
+        55,     53,     51,     49,     48,     46,     44,     42,   /* 1712 */
+        40,     38,     36,     34,     32,     30,     29,     27,   /* 1720 */
+        25,     23,     21,     19,     17,     15,     13,     11,   /* 1728 */
+        10,      8,      6,      4,      2,      0,     -2,     -4,   /* 1736 */
+        -6,     -7,     -9,    -11,    -13,    -15,    -17,    -19,   /* 1744 */
+       -21,    -22,    -24,    -26,    -28,    -30,    -32,    -34,   /* 1752 */
+       -36,    -37,    -39,    -41,    -43,    -45,    -47,    -49,   /* 1760 */
+       -51,    -52,    -54,    -56,    -58,    -60,    -62,    -64,   /* 1768 */
+       -66,    -67,    -69,    -71,    -73,    -75,    -77,    -79,   /* 1776 */
+       -81,    -82,    -84,    -86,    -88,    -90,    -92,    -94,   /* 1784 */
+       -95,    -97,    -99,   -101,   -103,   -105,   -107,   -108,   /* 1792 */
+      -110,   -112,   -114,   -116,   -118,   -120,   -121,   -123,   /* 1800 */
+      -125,   -127,   -129,   -131,   -133,   -134,   -136,   -138,   /* 1808 */
+      -140,   -142,   -144,   -145,   -147,   -149,   -151,   -153,   /* 1816 */
+      -155,   -157,   -158,   -160,   -162,   -164,   -166,   -168,   /* 1824 */
+      -169,   -171,   -173,   -175,   -177,   -179,   -181,   -182,   /* 1832 */
+      -184,   -186,   -188,   -190,   -192,   -193,   -195,   -197,   /* 1840 */
+      -199,   -201,   -203,   -204,   -206,   -208,   -210,   -212,   /* 1848 */
+      -214,   -215,   -217,   -219,   -221,   -223,   -225,   -226,   /* 1856 */
+      -228,   -230,   -232,   -234,   -236,   -237,   -239,   -241,   /* 1864 */
+      -243,   -245,   -247,   -248,   -250,   -252,   -254,   -256,   /* 1872 */
+      -257,   -259,   -261,   -263,   -265,   -267,   -268,   -270,   /* 1880 */
+      -272,   -274,   -276,   -277,   -279,   -281,   -283,   -285,   /* 1888 */
+      -287,   -288,   -290,   -292,   -294,   -296,   -297,   -299,   /* 1896 */
+      -301,   -303,   -305,   -307,   -308,   -310,   -312,   -314,   /* 1904 */
+      -316,   -317,   -319,   -321,   -323,   -325,   -326,   -328,   /* 1912 */
+      -330,   -332,   -334,   -335,   -337,   -339,   -341,   -343,   /* 1920 */
+      -345,   -346,   -348,   -350,   -352,   -354,   -355,   -357,   /* 1928 */
+      -359,   -361,   -363,   -364,   -366,   -368,   -370,   -372,   /* 1936 */
+      -373,   -375,   -377,   -379,   -381,   -382,   -384,   -386,   /* 1944 */
+      -388,   -390,   -391,   -393,   -395,   -397,   -398,   -400,   /* 1952 */
+      -402,   -404,   -406,   -407,   -409,   -411,   -413,   -415,   /* 1960 */
+      -416,   -418,   -420,   -422,   -424,   -425,   -427,   -429,   /* 1968 */
+      -431,   -433,   -434,   -436,   -438,   -440,   -441,   -443,   /* 1976 */
+      -445,   -447,   -449,   -450,   -452,   -454,   -456,   -458,   /* 1984 */
+      -459,   -461,   -463,   -465,   -466,   -468,   -470,   -472,   /* 1992 */
+      -474,   -475,   -477,   -479,   -481,   -483,   -484,   -486,   /* 2000 */
+      -488,   -490,   -491,   -493,   -495,   -497,   -499,   -500,   /* 2008 */
+      -502,   -504,   -506,   -507,   -509,   -511,   -513,   -515,   /* 2016 */
+      -516,   -518,   -520,   -522,   -523,   -525,   -527,   -529,   /* 2024 */
+      -531,   -532,   -534,   -536,   -538,   -539,   -541,   -543,   /* 2032 */
+      -545,   -546,   -548,   -550,   -552,   -554,   -555,   -557,   /* 2040 */
+      -559,   -561,   -562,   -564,   -566,   -568,   -570,   -571,   /* 2048 */
+      -573,   -575,   -577,   -578,   -580,   -582,   -584,   -585,   /* 2056 */
+      -587,   -589,   -591,   -592,   -594,   -596,   -598,   -600,   /* 2064 */
+      -601,   -603,   -605,   -607,   -608,   -610,   -612,   -614,   /* 2072 */
+      -615,   -617,   -619,   -621,   -622,   -624,   -626,   -628,   /* 2080 */
+      -630,   -631,   -633,   -635,   -637,   -638,   -640,   -642,   /* 2088 */
+      -644,   -645,   -647,   -649,   -651,   -652,   -654,   -656,   /* 2096 */
+      -658,   -659,   -661,   -663,   -665,   -666,   -668,   -670,   /* 2104 */
+      -672,   -674,   -675,   -677,   -679,   -681,   -682,   -684,   /* 2112 */
+      -686,   -688,   -689,   -691,   -693,   -695,   -696,   -698,   /* 2120 */
+      -700,   -702,   -703,   -705,   -707,   -709,   -710,   -712,   /* 2128 */
+      -714,   -716,   -717,   -719,   -721,   -723,   -724,   -726,   /* 2136 */
+      -728,   -730,   -731,   -733,   -735,   -737,   -738,   -740,   /* 2144 */
+      -742,   -744,   -745,   -747,   -749,   -751,   -752,   -754,   /* 2152 */
+      -756,   -758,   -759,   -761,   -763,   -765,   -766,   -768,   /* 2160 */
+      -770,   -772,   -773,   -775,   -777,   -779,   -780,   -782,   /* 2168 */
+      -784,   -786,   -787,   -789,   -791,   -793,   -794,   -796,   /* 2176 */
+      -798,   -800,   -801,   -803,   -805,   -807,   -808,   -810,   /* 2184 */
+      -812,   -814,   -815,   -817,   -819,   -821,   -822,   -824,   /* 2192 */
+      -826,   -828,   -829,   -831,   -833,   -835,   -836,   -838,   /* 2200 */
+      -840,   -841,   -843,   -845,   -847,   -848,   -850,   -852,   /* 2208 */
+      -854,   -855,   -857,   -859,   -861,   -862,   -864,   -866,   /* 2216 */
+      -868,   -869,   -871,   -873,   -875,   -876,   -878,   -880,   /* 2224 */
+      -882,   -883,   -885,   -887,   -889,   -890,   -892,   -894,   /* 2232 */
+      -896,   -897,   -899,   -901,   -902,   -904,   -906,   -908,   /* 2240 */
+      -909,   -911,   -913,   -915,   -916,   -918,   -920,   -922,   /* 2248 */
+      -923,   -925,   -927,   -929,   -930,   -932,   -934,   -936,   /* 2256 */
+      -937,   -939,   -941,   -943,   -944,   -946,   -948,   -949,   /* 2264 */
+      -951,   -953,   -955,   -956,   -958,   -960,   -962,   -963,   /* 2272 */
+      -965,   -967,   -969,   -970,   -972,   -974,   -976,   -977,   /* 2280 */
+      -979,   -981,   -983,   -984,   -986,   -988,   -989,   -991,   /* 2288 */
+      -993,   -995,   -996,   -998,  -1000,  -1002,  -1003,  -1005,   /* 2296 */
+     -1007,  -1009,  -1010,  -1012,  -1014,  -1016,  -1017,  -1019,   /* 2304 */
+     -1021,  -1023,  -1024,  -1026,  -1028,  -1029,  -1031,  -1033,   /* 2312 */
+     -1035,  -1036,  -1038,  -1040,  -1042,  -1043,  -1045,  -1047,   /* 2320 */
+     -1049,  -1050,  -1052,  -1054,  -1056,  -1057,  -1059,  -1061,   /* 2328 */
+     -1063,  -1064,  -1066,  -1068,  -1069,  -1071,  -1073,  -1075,   /* 2336 */
+     -1076,  -1078,  -1080,  -1082,  -1083,  -1085,  -1087,  -1089,   /* 2344 */
+     -1090,  -1092,  -1094,  -1096,  -1097,  -1099,  -1101,  -1103,   /* 2352 */
+     -1104,  -1106,  -1108,  -1109,  -1111,  -1113,  -1115,  -1116,   /* 2360 */
+     -1118,  -1120,  -1122,  -1123,  -1125,  -1127,  -1129,  -1130,   /* 2368 */
+     -1132,  -1134,  -1136,  -1137,  -1139,  -1141,  -1143,  -1144,   /* 2376 */
+     -1146,  -1148,  -1149,  -1151,  -1153,  -1155,  -1156,  -1158,   /* 2384 */
+     -1160,  -1162,  -1163,  -1165,  -1167,  -1169,  -1170,  -1172,   /* 2392 */
+     -1174,  -1176,  -1177,  -1179,  -1181,  -1183,  -1184,  -1186,   /* 2400 */
+     -1188,  -1190,  -1191,  -1193,  -1195,  -1196,  -1198,  -1200,   /* 2408 */
+     -1202,  -1203,  -1205,  -1207,  -1209,  -1210,  -1212,  -1214,   /* 2416 */
+     -1216,  -1217,  -1219,  -1221,  -1223,  -1224,  -1226,  -1228,   /* 2424 */
+     -1230,  -1231,  -1233,  -1235,  -1237,  -1238,  -1240,  -1242,   /* 2432 */
+     -1244,  -1245,  -1247,  -1249,  -1251,  -1252,  -1254,  -1256,   /* 2440 */
+     -1258,  -1259,  -1261,  -1263,  -1265,  -1266,  -1268,  -1270,   /* 2448 */
+     -1272,  -1273,  -1275,  -1277,  -1279,  -1280,  -1282,  -1284,   /* 2456 */
+     -1285,  -1287,  -1289,  -1291,  -1292,  -1294,  -1296,  -1298,   /* 2464 */
+     -1299,  -1301,  -1303,  -1305,  -1306,  -1308,  -1310,  -1312,   /* 2472 */
+     -1313,  -1315,  -1317,  -1319,  -1320,  -1322,  -1324,  -1326,   /* 2480 */
+     -1327,  -1329,  -1331,  -1333,  -1334,  -1336,  -1338,  -1340,   /* 2488 */
+     -1341,  -1343,  -1345,  -1347,  -1349,  -1350,  -1352,  -1354,   /* 2496 */
+     -1356,  -1357,  -1359,  -1361,  -1363,  -1364,  -1366,  -1368,   /* 2504 */
+     -1370,  -1371,  -1373,  -1375,  -1377,  -1378,  -1380,  -1382,   /* 2512 */
+     -1384,  -1385,  -1387,  -1389,  -1391,  -1392,  -1394,  -1396,   /* 2520 */
+     -1398,  -1399,  -1401,  -1403,  -1405,  -1406,  -1408,  -1410,   /* 2528 */
+     -1412,  -1413,  -1415,  -1417,  -1419,  -1421,  -1422,  -1424,   /* 2536 */
+     -1426,  -1428,  -1429,  -1431,  -1433,  -1435,  -1436,  -1438,   /* 2544 */
+     -1440,  -1442,  -1443,  -1445,  -1447,  -1449,  -1450,  -1452,   /* 2552 */
+     -1454,  -1456,  -1458,  -1459,  -1461,  -1463,  -1465,  -1466,   /* 2560 */
+     -1468,  -1470,  -1472,  -1473,  -1475,  -1477,  -1479,  -1480,   /* 2568 */
+     -1482,  -1484,  -1486,  -1488,  -1489,  -1491,  -1493,  -1495,   /* 2576 */
+     -1496,  -1498,  -1500,  -1502,  -1504,  -1505,  -1507,  -1509,   /* 2584 */
+     -1511,  -1512,  -1514,  -1516,  -1518,  -1519,  -1521,  -1523,   /* 2592 */
+     -1525,  -1527,  -1528,  -1530,  -1532,  -1534,  -1535,  -1537,   /* 2600 */
+     -1539,  -1541,  -1543,  -1544,  -1546,  -1548,  -1550,  -1551,   /* 2608 */
+     -1553,  -1555,  -1557,  -1559,  -1560,  -1562,  -1564,  -1566,   /* 2616 */
+     -1567,  -1569,  -1571,  -1573,  -1575,  -1576,  -1578,  -1580,   /* 2624 */
+     -1582,  -1583,  -1585,  -1587,  -1589,  -1591,  -1592,  -1594,   /* 2632 */
+     -1596,  -1598,  -1600,  -1601,  -1603,  -1605,  -1607,  -1608,   /* 2640 */
+     -1610,  -1612,  -1614,  -1616,  -1617,  -1619,  -1621,  -1623,   /* 2648 */
+     -1625,  -1626,  -1628,  -1630,  -1632,  -1634,  -1635,  -1637,   /* 2656 */
+     -1639,  -1641,  -1642,  -1644,  -1646,  -1648,  -1650,  -1651,   /* 2664 */
+     -1653,  -1655,  -1657,  -1659,  -1660,  -1662,  -1664,  -1666,   /* 2672 */
+     -1668,  -1669,  -1671,  -1673,  -1675,  -1677,  -1678,  -1680,   /* 2680 */
+     -1682,  -1684,  -1686,  -1687,  -1689,  -1691,  -1693,  -1695,   /* 2688 */
+     -1696,  -1698,  -1700,  -1702,  -1704,  -1705,  -1707,  -1709,   /* 2696 */
+     -1711,  -1713,  -1714,  -1716,  -1718,  -1720,  -1722,  -1724,   /* 2704 */
+     -1725,  -1727,  -1729,  -1731,  -1733,  -1734,  -1736,  -1738,   /* 2712 */
+     -1740,  -1742,  -1743,  -1745,  -1747,  -1749,  -1751,  -1753,   /* 2720 */
+     -1754,  -1756,  -1758,  -1760,  -1762,  -1763,  -1765,  -1767,   /* 2728 */
+     -1769,  -1771,  -1773,  -1774,  -1776,  -1778,  -1780,  -1782,   /* 2736 */
+     -1783,  -1785,  -1787,  -1789,  -1791,  -1793,  -1794,  -1796,   /* 2744 */
+     -1798,  -1800,  -1802,  -1804,  -1805,  -1807,  -1809,  -1811,   /* 2752 */
+     -1813,  -1815,  -1816,  -1818,  -1820,  -1822,  -1824,  -1826,   /* 2760 */
+     -1827,  -1829,  -1831,  -1833,  -1835,  -1837,  -1838,  -1840,   /* 2768 */
+     -1842,  -1844,  -1846,  -1848,  -1849,  -1851,  -1853,  -1855,   /* 2776 */
+     -1857,  -1859,  -1860,  -1862,  -1864,  -1866,  -1868,  -1870,   /* 2784 */
+     -1871,  -1873,  -1875,  -1877,  -1879,  -1881,  -1883,  -1884,   /* 2792 */
+     -1886,  -1888,  -1890,  -1892,  -1894,  -1896,  -1897,  -1899,   /* 2800 */
+     -1901,  -1903,  -1905,  -1907,  -1908,  -1910,  -1912,  -1914,   /* 2808 */
+     -1916,  -1918,  -1920,  -1921,  -1923,  -1925,  -1927,  -1929,   /* 2816 */
+     -1931,  -1933,  -1934,  -1936,  -1938,  -1940,  -1942,  -1944,   /* 2824 */
+     -1946,  -1948,  -1949,  -1951,  -1953,  -1955,  -1957,  -1959,   /* 2832 */
+     -1961,  -1962,  -1964,  -1966,  -1968,  -1970,  -1972,  -1974,   /* 2840 */
+     -1976,  -1977,  -1979,  -1981,  -1983,  -1985,  -1987,  -1989,   /* 2848 */
+     -1991,  -1992,  -1994,  -1996,  -1998,  -2000,  -2002,  -2004,   /* 2856 */
+     -2006,  -2008,  -2009,  -2011,  -2013,  -2015,  -2017,  -2019,   /* 2864 */
+     -2021,  -2023,  -2025,  -2026,  -2028,  -2030,  -2032,  -2034,   /* 2872 */
+     -2036,  -2038,  -2040,  -2042,  -2043,  -2045,  -2047,  -2049,   /* 2880 */
+     -2051,  -2053,  -2055,  -2057,  -2059,  -2061,  -2062,  -2064,   /* 2888 */
+     -2066,  -2068,  -2070,  -2072,  -2074,  -2076,  -2078,  -2080,   /* 2896 */
+     -2081,  -2083,  -2085,  -2087,  -2089,  -2091,  -2093,  -2095,   /* 2904 */
+     -2097,  -2099,  -2101,  -2103,  -2104,  -2106,  -2108,  -2110,   /* 2912 */
+     -2112,  -2114,  -2116,  -2118,  -2120,  -2122,  -2124,  -2126,   /* 2920 */
+     -2127,  -2129,  -2131,  -2133,  -2135,  -2137,  -2139,  -2141,   /* 2928 */
+     -2143,  -2145,  -2147,  -2149,  -2151,  -2153,  -2155,  -2156,   /* 2936 */
+     -2158,  -2160,  -2162,  -2164,  -2166,  -2168,  -2170,  -2172,   /* 2944 */
+     -2174,  -2176,  -2178,  -2180,  -2182,  -2184,  -2186,  -2188,   /* 2952 */
+     -2189,  -2191,  -2193,  -2195,  -2197,  -2199,  -2201,  -2203,   /* 2960 */
+     -2205,  -2207,  -2209,  -2211,  -2213,  -2215,  -2217,  -2219,   /* 2968 */
+     -2221,  -2223,  -2225,  -2227,  -2229,  -2231,  -2232,  -2234,   /* 2976 */
+     -2236,  -2238,  -2240,  -2242,  -2244,  -2246,  -2248,  -2250,   /* 2984 */
+     -2252,  -2254,  -2256,  -2258,  -2260,  -2262,  -2264,  -2266,   /* 2992 */
+     -2268,  -2270,  -2272,  -2274,  -2276,  -2278,  -2280,  -2282,   /* 3000 */
+     -2284,  -2286,  -2288,  -2290,  -2292,  -2294,  -2296,  -2298,   /* 3008 */
+     -2300,  -2302,  -2304,  -2306,  -2308,  -2310,  -2312,  -2314,   /* 3016 */
+     -2316,  -2318,  -2320,  -2322,  -2324,  -2326,  -2328,  -2330,   /* 3024 */
+     -2332,  -2334,  -2336,  -2338,  -2340,  -2342,  -2344,  -2346,   /* 3032 */
+     -2348,  -2350,  -2352,  -2354,  -2356,  -2358,  -2360,  -2362,   /* 3040 */
+     -2364,  -2366,  -2368,  -2370,  -2372,  -2374,  -2376,  -2378,   /* 3048 */
+     -2380,  -2382,  -2384,  -2386,  -2388,  -2390,  -2392,  -2394,   /* 3056 */
+     -2397,  -2399,  -2401,  -2403,  -2405,  -2407,  -2409,  -2411,   /* 3064 */
+     -2413,  -2415,  -2417,  -2419,  -2421,  -2423,  -2425,  -2427,   /* 3072 */
+     -2429,  -2431,  -2433,  -2435,  -2437,  -2440,  -2442,  -2444,   /* 3080 */
+     -2446,  -2448,  -2450,  -2452,  -2454,  -2456,  -2458,  -2460,   /* 3088 */
+     -2462,  -2464,  -2466,  -2468,  -2471,  -2473,  -2475,  -2477,   /* 3096 */
+     -2479,  -2481,  -2483,  -2485,  -2487,  -2489,  -2491,  -2493,   /* 3104 */
+     -2495,  -2498,  -2500,  -2502,  -2504,  -2506,  -2508,  -2510,   /* 3112 */
+     -2512,  -2514,  -2516,  -2519,  -2521,  -2523,  -2525,  -2527,   /* 3120 */
+     -2529,  -2531,  -2533,  -2535,  -2537,  -2540,  -2542,  -2544,   /* 3128 */
+     -2546,  -2548,  -2550,  -2552,  -2554,  -2557,  -2559,  -2561,   /* 3136 */
+     -2563,  -2565,  -2567,  -2569,  -2571,  -2574,  -2576,  -2578,   /* 3144 */
+     -2580,  -2582,  -2584,  -2586,  -2588,  -2591,  -2593,  -2595,   /* 3152 */
+     -2597,  -2599,  -2601,  -2603,  -2606,  -2608,  -2610,  -2612,   /* 3160 */
+     -2614,  -2616,  -2619,  -2621,  -2623,  -2625,  -2627,  -2629,   /* 3168 */
+     -2631,  -2634,  -2636,  -2638,  -2640,  -2642,  -2644,  -2647,   /* 3176 */
+     -2649,  -2651,  -2653,  -2655,  -2658,  -2660,  -2662,  -2664,   /* 3184 */
+     -2666,  -2668,  -2671,  -2673,  -2675,  -2677,  -2679,  -2682,   /* 3192 */
+     -2684,  -2686,  -2688,  -2690,  -2693,  -2695,  -2697,  -2699,   /* 3200 */
+     -2701,  -2704,  -2706,  -2708,  -2710,  -2712,  -2715,  -2717,   /* 3208 */
+     -2719,  -2721,  -2724,  -2726,  -2728,  -2730,  -2732,  -2735,   /* 3216 */
+     -2737,  -2739,  -2741,  -2744,  -2746,  -2748,  -2750,  -2753,   /* 3224 */
+     -2755,  -2757,  -2759,  -2762,  -2764,  -2766,  -2768,  -2771,   /* 3232 */
+     -2773,  -2775,  -2777,  -2780,  -2782,  -2784,  -2786,  -2789,   /* 3240 */
+     -2791,  -2793,  -2795,  -2798,  -2800,  -2802,  -2804,  -2807,   /* 3248 */
+     -2809,  -2811,  -2814,  -2816,  -2818,  -2820,  -2823,  -2825,   /* 3256 */
+     -2827,  -2830,  -2832,  -2834,  -2837,  -2839,  -2841,  -2843,   /* 3264 */
+     -2846,  -2848,  -2850,  -2853,  -2855,  -2857,  -2860,  -2862,   /* 3272 */
+     -2864,  -2867,  -2869,  -2871,  -2874,  -2876,  -2878,  -2880,   /* 3280 */
+     -2883,  -2885,  -2887,  -2890,  -2892,  -2895,  -2897,  -2899,   /* 3288 */
+     -2902,  -2904,  -2906,  -2909,  -2911,  -2913,  -2916,  -2918,   /* 3296 */
+     -2920,  -2923,  -2925,  -2927,  -2930,  -2932,  -2935,  -2937,   /* 3304 */
+     -2939,  -2942,  -2944,  -2946,  -2949,  -2951,  -2954,  -2956,   /* 3312 */
+     -2958,  -2961,  -2963,  -2966,  -2968,  -2970,  -2973,  -2975,   /* 3320 */
+     -2978,  -2980,  -2982,  -2985,  -2987,  -2990,  -2992,  -2994,   /* 3328 */
+     -2997,  -2999,  -3002,  -3004,  -3007,  -3009,  -3011,  -3014,   /* 3336 */
+     -3016,  -3019,  -3021,  -3024,  -3026,  -3029,  -3031,  -3033,   /* 3344 */
+     -3036,  -3038,  -3041,  -3043,  -3046,  -3048,  -3051,  -3053,   /* 3352 */
+     -3056,  -3058,  -3061,  -3063,  -3065,  -3068,  -3070,  -3073,   /* 3360 */
+     -3075,  -3078,  -3080,  -3083,  -3085,  -3088,  -3090,  -3093,   /* 3368 */
+     -3095,  -3098,  -3100,  -3103,  -3105,  -3108,  -3110,  -3113,   /* 3376 */
+     -3115,  -3118,  -3121,  -3123,  -3126,  -3128,  -3131,  -3133,   /* 3384 */
+     -3136,  -3138,  -3141,  -3143,  -3146,  -3148,  -3151,  -3154,   /* 3392 */
+     -3156,  -3159,  -3161,  -3164,  -3166,  -3169,  -3172,  -3174,   /* 3400 */
+     -3177,  -3179,  -3182,  -3184,  -3187,  -3190,  -3192,  -3195,   /* 3408 */
+     -3197,  -3200,  -3203,  -3205,  -3208,  -3210,  -3213,  -3216,   /* 3416 */
+     -3218,  -3221,  -3224,  -3226,  -3229,  -3231,  -3234,  -3237,   /* 3424 */
+     -3239,  -3242,  -3245,  -3247,  -3250,  -3253,  -3255,  -3258,   /* 3432 */
+     -3261,  -3263,  -3266,  -3269,  -3271,  -3274,  -3277,  -3279,   /* 3440 */
+     -3282,  -3285,  -3287,  -3290,  -3293,  -3295,  -3298,  -3301,   /* 3448 */
+     -3304,  -3306,  -3309,  -3312,  -3314,  -3317,  -3320,  -3323,   /* 3456 */
+     -3325,  -3328,  -3331,  -3333,  -3336,  -3339,  -3342,  -3344,   /* 3464 */
+     -3347,  -3350,  -3353,  -3355,  -3358,  -3361,  -3364,  -3367,   /* 3472 */
+     -3369,  -3372,  -3375,  -3378,  -3380,  -3383,  -3386,  -3389,   /* 3480 */
+     -3392,  -3394,  -3397,  -3400,  -3403,  -3406,  -3408,  -3411,   /* 3488 */
+     -3414,  -3417,  -3420,  -3423,  -3425,  -3428,  -3431,  -3434,   /* 3496 */
+     -3437,  -3440,  -3443,  -3445,  -3448,  -3451,  -3454,  -3457,   /* 3504 */
+     -3460,  -3463,  -3466,  -3468,  -3471,  -3474,  -3477,  -3480,   /* 3512 */
+     -3483,  -3486,  -3489,  -3492,  -3495,  -3498,  -3500,  -3503,   /* 3520 */
+     -3506,  -3509,  -3512,  -3515,  -3518,  -3521,  -3524,  -3527,   /* 3528 */
+     -3530,  -3533,  -3536,  -3539,  -3542,  -3545,  -3548,  -3551,   /* 3536 */
+     -3554,  -3557,  -3560,  -3563,  -3566,  -3569,  -3572,  -3575,   /* 3544 */
+     -3578,  -3581,  -3584,  -3587,  -3590,  -3593,  -3596,  -3599,   /* 3552 */
+     -3602,  -3605,  -3608,  -3612,  -3615,  -3618,  -3621,  -3624,   /* 3560 */
+     -3627,  -3630,  -3633,  -3636,  -3639,  -3642,  -3646,  -3649,   /* 3568 */
+     -3652,  -3655,  -3658,  -3661,  -3664,  -3667,  -3671,  -3674,   /* 3576 */
+     -3677,  -3680,  -3683,  -3686,  -3690,  -3693,  -3696,  -3699,   /* 3584 */
+     -3702,  -3706,  -3709,  -3712,  -3715,  -3718,  -3722,  -3725,   /* 3592 */
+     -3728,  -3731,  -3735,  -3738,  -3741,  -3744,  -3748,  -3751,   /* 3600 */
+     -3754,  -3757,  -3761,  -3764,  -3767,  -3771,  -3774,  -3777,   /* 3608 */
+     -3781,  -3784,  -3787,  -3791,  -3794,  -3797,  -3801,  -3804,   /* 3616 */
+     -3807,  -3811,  -3814,  -3817,  -3821,  -3824,  -3827,  -3831,   /* 3624 */
+     -3834,  -3838,  -3841,  -3844,  -3848,  -3851,  -3855,  -3858,   /* 3632 */
+     -3862,  -3865,  -3869,  -3872,  -3875,  -3879,  -3882,  -3886,   /* 3640 */
+     -3889,  -3893,  -3896,  -3900,  -3903,  -3907,  -3910,  -3914,   /* 3648 */
+     -3917,  -3921,  -3925,  -3928,  -3932,  -3935,  -3939,  -3942,   /* 3656 */
+     -3946,  -3950,  -3953,  -3957,  -3960,  -3964,  -3968,  -3971,   /* 3664 */
+     -3975,  -3978,  -3982,  -3986,  -3989,  -3993,  -3997,  -4000,   /* 3672 */
+     -4004,  -4008,  -4012,  -4015,  -4019,  -4023,  -4026,  -4030,   /* 3680 */
+     -4034,  -4038,  -4041,  -4045,  -4049,  -4053,  -4056,  -4060,   /* 3688 */
+     -4064,  -4068,  -4072,  -4075,  -4079,  -4083,  -4087,  -4091,   /* 3696 */
+     -4095,  -4099,  -4102,  -4106,  -4110,  -4114,  -4118,  -4122,   /* 3704 */
+     -4126,  -4130,  -4134,  -4138,  -4142,  -4145,  -4149,  -4153,   /* 3712 */
+     -4157,  -4161,  -4165,  -4169,  -4173,  -4177,  -4181,  -4186,   /* 3720 */
+     -4190,  -4194,  -4198,  -4202,  -4206,  -4210,  -4214,  -4218,   /* 3728 */
+     -4222,  -4226,  -4231,  -4235,  -4239,  -4243,  -4247,  -4251,   /* 3736 */
+     -4256,  -4260,  -4264,  -4268,  -4272,  -4277,  -4281,  -4285,   /* 3744 */
+     -4289,  -4294,  -4298,  -4302,  -4307,  -4311,  -4315,  -4320,   /* 3752 */
+     -4324,  -4328,  -4333,  -4337,  -4341,  -4346,  -4350,  -4355,   /* 3760 */
+     -4359,  -4363,  -4368,  -4372,  -4377,  -4381,  -4386,  -4390,   /* 3768 */
+     -4395,  -4399,  -4404,  -4408,  -4413,  -4418,  -4422,  -4427,   /* 3776 */
+     -4431,  -4436,  -4441,  -4445,  -4450,  -4455,  -4459,  -4464,   /* 3784 */
+     -4469,  -4473,  -4478,  -4483,  -4488,  -4492,  -4497,  -4502,   /* 3792 */
+     -4507,  -4512,  -4516,  -4521,  -4526,  -4531,  -4536,  -4541,   /* 3800 */
+     -4546,  -4551,  -4555,  -4560,  -4565,  -4570,  -4575,  -4580,   /* 3808 */
+     -4585,  -4590,  -4596,  -4601,  -4606,  -4611,  -4616,  -4621,   /* 3816 */
+     -4626,  -4631,  -4636,  -4642,  -4647,  -4652,  -4657,  -4663,   /* 3824 */
+     -4668,  -4673,  -4678,  -4684,  -4689,  -4694,  -4700,  -4705,   /* 3832 */
+     -4711,  -4716,  -4721,  -4727,  -4732,  -4738,  -4743,  -4749,   /* 3840 */
+     -4754,  -4760,  -4766,  -4771,  -4777,  -4782,  -4788,  -4794,   /* 3848 */
+     -4799,  -4805,  -4811,  -4817,  -4822,  -4828,  -4834,  -4840,   /* 3856 */
+     -4846,  -4852,  -4857,  -4863,  -4869,  -4875,  -4881,  -4887,   /* 3864 */
+     -4893,  -4899,  -4905,  -4911,  -4918,  -4924,  -4930,  -4936,   /* 3872 */
+     -4942,  -4949,  -4955,  -4961,  -4967,  -4974,  -4980,  -4986,   /* 3880 */
+     -4993,  -4999,  -5006,  -5012,  -5019,  -5025,  -5032,  -5038,   /* 3888 */
+     -5045,  -5052,  -5058,  -5065,  -5072,  -5079,  -5085,  -5092,   /* 3896 */
+     -5099,  -5106,  -5113,  -5120,  -5127,  -5134,  -5141,  -5148,   /* 3904 */
+     -5155,  -5162,  -5169,  -5176,  -5184,  -5191,  -5198,  -5205,   /* 3912 */
+     -5213,  -5220,  -5228,  -5235,  -5243,  -5250,  -5258,  -5265,   /* 3920 */
+     -5273,  -5281,  -5288,  -5296,  -5304,  -5312,  -5320,  -5328,   /* 3928 */
+     -5336,  -5344,  -5352,  -5360,  -5368,  -5376,  -5385,  -5393,   /* 3936 */
+     -5401,  -5410,  -5418,  -5426,  -5435,  -5444,  -5452,  -5461,   /* 3944 */
+     -5470,  -5478,  -5487,  -5496,  -5505,  -5514,  -5523,  -5532,   /* 3952 */
+     -5541,  -5551,  -5560,  -5569,  -5579,  -5588,  -5598,  -5607,   /* 3960 */
+     -5617,  -5627,  -5636,  -5646,  -5656,  -5666,  -5676,  -5686,   /* 3968 */
+     -5697,  -5707,  -5717,  -5728,  -5738,  -5749,  -5759,  -5770,   /* 3976 */
+     -5781,  -5792,  -5803,  -5814,  -5825,  -5836,  -5848,  -5859,   /* 3984 */
+     -5871,  -5882,  -5894,  -5906,  -5918,  -5930,  -5942,  -5954,   /* 3992 */
+     -5967,  -5979,  -5992,  -6005,  -6017,  -6030,  -6043,  -6057,   /* 4000 */
+     -6070,  -6084,  -6097,  -6111,  -6125,  -6139,  -6153,  -6167,   /* 4008 */
+     -6182,  -6197,  -6211,  -6226,  -6242,  -6257,  -6273,  -6288,   /* 4016 */
+     -6304,  -6320,  -6337,  -6353,  -6370,  -6387,  -6404,  -6421,   /* 4024 */
+     -6439,  -6457,  -6475,  -6494,  -6512,  -6531,  -6551,  -6570,   /* 4032 */
+     -6590,  -6610,  -6631,  -6652,  -6673,  -6695,  -6717,  -6739,   /* 4040 */
+     -6762,  -6785,  -6809,  -6833,  -6857,  -6883,  -6908,  -6935,   /* 4048 */
+     -6961,  -6989,  -7017,  -7046,  -7075,  -7106,  -7137,  -7169,   /* 4056 */
+     -7201,  -7235,  -7270,  -7306,  -7343,  -7381,  -7421,  -7462,   /* 4064 */
+     -7504,  -7549,  -7595,  -7643,  -7693,  -7746,  -7802,  -7860,   /* 4072 */
+     -7922,  -7988,  -8058,  -8133,  -8214,  -8302,  -8398,  -8504,   /* 4080 */
+     -8623,  -8759,  -8917,  -9106,  -9345,  -9670, -10200, -32768,   /* 4088 */
+};
@@ -0,0 +1,111 @@
+#include "timebase.h"
+#include "cycles.h"
+#include "tim.h"
+
+static volatile uint32_t cyc_hi;
+static volatile uint32_t cyc_last;
+static uint32_t cyc_per_us;
+
+static volatile uint32_t us_hi;
+static volatile uint32_t us_last;
+static volatile uint8_t running;
+
+void timebase_init(void)
+{
+    cycles_init();
+    cyc_hi = 0;
+    cyc_last = 0;
+    cyc_per_us = SystemCoreClock / 1000000u;
+
+    us_hi = 0;
+    us_last = 0;
+    __HAL_TIM_SET_COUNTER(&htim2, 0);
+    __HAL_TIM_ENABLE_IT(&htim2, TIM_IT_CC1);
+    HAL_TIM_Base_Start(&htim2);
+
+    running = 1;
+    HAL_SuspendTick();                      // nothing needs the 1 kHz SysTick now
+}
+
+/*
+ * Both 64-bit reads are callable from thread and IRQ context alike: the
+ * high word is bumped when the counter is seen to go backwards, inside a
+ * few cycles with interrupts off.
+ */
+uint64_t system_uptime_us(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t now = timebase_now_us();
+
+    if (now < us_last)
+        us_hi++;
+    us_last = now;
+
+    uint64_t t = ((uint64_t)us_hi << 32) | now;
+
+    __set_PRIMASK(primask);
+    return t;
+}
+
+uint64_t timebase_cycles(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t now = cycles_now();
+
+    if (now < cyc_last)
+        cyc_hi++;
+    cyc_last = now;
+
+    uint64_t t = ((uint64_t)cyc_hi << 32) | now;
+
+    __set_PRIMASK(primask);
+    return t;
+}
+
+uint32_t timebase_cycles_per_us(void)
+{
+    return cyc_per_us;
+}
+
+/*
+ * Interrupts stay masked from arming CC1 to WFI, so an interrupt that
+ * lands in between still wakes WFI (it is pending) instead of being
+ * serviced just before we go to sleep; the same goes for work an ISR
+ * flagged in *ready. If the deadline is already here when CC1 is armed
+ * the match could be missed, so we don't sleep at all.
+ */
+uint32_t timebase_sleep_until(uint32_t wake_us, const volatile uint32_t *ready)
+{
+    uint32_t slept = 0;
+
+    (void)system_uptime_us();
+    (void)timebase_cycles();
+
+    __disable_irq();
+
+    uint32_t t0 = timebase_now_us();
+
+    if ((int32_t)(wake_us - t0) > (int32_t)TIMEBASE_MAX_SLEEP_US)
+        wake_us = t0 + TIMEBASE_MAX_SLEEP_US;
+
+    __HAL_TIM_SET_COMPARE(&htim2, TIM_CHANNEL_1, wake_us);
+    __HAL_TIM_CLEAR_FLAG(&htim2, TIM_FLAG_CC1);
+
+    if (*ready == 0 && (int32_t)(wake_us - timebase_now_us()) > 0) {
+        __WFI();
+        slept = timebase_now_us() - t0;
+    }
+
+    __enable_irq();
+    return slept;
+}
+
+/* HAL timeouts follow TIM2 once SysTick is stopped */
+uint32_t HAL_GetTick(void)
+{
+    return running ? (uint32_t)(system_uptime_us() / 1000u) : uwTick;
+}
@@ -26,6 +26,7 @@
 
 UART_HandleTypeDef huart2;
 DMA_HandleTypeDef hdma_usart2_rx;
+DMA_HandleTypeDef hdma_usart2_tx;
 
 /* USART2 init function */
 
@@ -100,6 +101,24 @@ void HAL_UART_MspInit(UART_HandleTypeDef* uartHandle)
 
     __HAL_LINKDMA(uartHandle,hdmarx,hdma_usart2_rx);
 
+    /* USART2_TX Init */
+    hdma_usart2_tx.Instance = DMA1_Stream6;
+    hdma_usart2_tx.Init.Channel = DMA_CHANNEL_4;
+    hdma_usart2_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    hdma_usart2_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_usart2_tx.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_usart2_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_usart2_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    hdma_usart2_tx.Init.Mode = DMA_NORMAL;
+    hdma_usart2_tx.Init.Priority = DMA_PRIORITY_LOW;
+    hdma_usart2_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&hdma_usart2_tx) != HAL_OK)
+    {
+      Error_Handler();
+    }
+
+    __HAL_LINKDMA(uartHandle,hdmatx,hdma_usart2_tx);
+
     /* USART2 interrupt Init */
     HAL_NVIC_SetPriority(USART2_IRQn, 0, 0);
     HAL_NVIC_EnableIRQ(USART2_IRQn);
@@ -128,6 +147,7 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* uartHandle)
 
     /* USART2 DMA DeInit */
     HAL_DMA_DeInit(uartHandle->hdmarx);
+    HAL_DMA_DeInit(uartHandle->hdmatx);
 
     /* USART2 interrupt Deinit */
     HAL_NVIC_DisableIRQ(USART2_IRQn);
@@ -139,4 +159,52 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* uartHandle)
 
 /* USER CODE BEGIN 1 */
 
+/*
+ * USART2 sits on APB1 (42 MHz). OVER16 reaches pclk/16 = 2.625 Mbaud,
+ * OVER8 doubles that to 5.25 Mbaud at the cost of noise margin, so OVER8
+ * is only used when the rate needs it. Returns the baud the BRR really
+ * produces, or 0 if the rate is out of range.
+ */
+uint32_t usart2_baud_plan(uint32_t baud, uint32_t *brr, uint8_t *over8)
+{
+  uint32_t pclk = HAL_RCC_GetPCLK1Freq();
+
+  if (baud < USART_BAUD_MIN || baud > pclk / 8)
+    return 0;
+
+  if (baud <= pclk / 16)
+  {
+    *over8 = 0;
+    *brr = UART_BRR_SAMPLING16(pclk, baud);
+    return pclk / *brr;                 // baud = pclk / (16 * DIV), BRR = 16 * DIV
+  }
+
+  *over8 = 1;
+  *brr = UART_BRR_SAMPLING8(pclk, baud);
+  return pclk / (((*brr >> 4) << 3) + (*brr & 0x07U));
+}
+
+/*
+ * Reprogram USART2 in place: UE is dropped only for the BRR/OVER8 write,
+ * so both DMA streams stay armed. Callers make sure TX has drained.
+ */
+int usart2_set_baud(uint32_t baud)
+{
+  uint32_t brr;
+  uint8_t over8;
+
+  if (usart2_baud_plan(baud, &brr, &over8) == 0)
+    return -1;
+
+  __HAL_UART_DISABLE(&huart2);
+  MODIFY_REG(huart2.Instance->CR1, USART_CR1_OVER8, over8 ? USART_CR1_OVER8 : 0U);
+  WRITE_REG(huart2.Instance->BRR, brr);
+  __HAL_UART_CLEAR_OREFLAG(&huart2);    // reads SR then DR: drops FE/NE/ORE from the switch
+  __HAL_UART_ENABLE(&huart2);
+
+  huart2.Init.BaudRate = baud;
+  huart2.Init.OverSampling = over8 ? UART_OVERSAMPLING_8 : UART_OVERSAMPLING_16;
+  return 0;
+}
+
 /* USER CODE END 1 */
@@ -0,0 +1,251 @@
+#include "watch.h"
+#include "main.h"
+#include "adc_app.h"
+#include "adc_ring.h"
+#include "console.h"
+#include "fmt.h"
+#include "ntc.h"
+#include <math.h>
+#include <string.h>
+
+#define WATCH_LINE_SIZE (32 + ADC_MAX_CHANNELS * 40)
+
+typedef struct {
+    const char *name;
+    void (*emit)(void);
+} watch_metric_t;
+
+typedef struct {
+    const watch_metric_t *m;        // NULL: free slot
+    uint32_t period_ms;
+    uint32_t next_ms;
+    uint32_t late;
+} watch_slot_t;
+
+static watch_slot_t slots[WATCH_SLOTS];
+
+/* one line per emit, queued with a single write so DROP never tears it */
+static char line[WATCH_LINE_SIZE];
+static uint32_t line_len;
+
+static void line_add(const char *fmt, ...)
+{
+    va_list ap;
+
+    if (line_len >= sizeof(line) - 1)
+        return;                             // full: the rest is cut
+
+    char *at = &line[line_len];
+    uint32_t room = sizeof(line) - line_len;
+
+    va_start(ap, fmt);
+    line_len += fmt_vsnprintf(at, room, fmt, ap);
+    va_end(ap);
+}
+
+static void emit_avg(void)
+{
+    for (uint8_t i = 0; i < adc_app_ch_count(); i++)
+        line_add(" ch%u=%u", adc_app_ch_num(i), adc_app_average(i));
+}
+
+static void emit_latest(void)
+{
+    for (uint8_t i = 0; i < adc_app_ch_count(); i++) {
+        uint16_t raw;
+
+        if (!adc_app_snapshot(i, &raw, 1)) {
+            line_add(" off");
+            return;
+        }
+        line_add(" ch%u=%u", adc_app_ch_num(i), raw);
+    }
+}
+
+static void emit_volts(void)
+{
+    for (uint8_t i = 0; i < adc_app_ch_count(); i++)
+        line_add(" ch%u=%lu", adc_app_ch_num(i), adc_to_voltage(adc_app_average(i)));
+}
+
+/* chN=min/max/mean/sd */
+static void emit_stats(void)
+{
+    for (uint8_t i = 0; i < adc_app_ch_count(); i++) {
+        adc_stats_snapshot_t ss;
+
+        adc_app_stats_get(i, &ss);
+
+        uint32_t mean_x100 = (uint32_t)(ss.mean * 100.0f + 0.5f);
+        uint32_t sd_x100   = (uint32_t)(sqrtf(ss.var) * 100.0f + 0.5f);
+
+        line_add(" ch%u=%u/%u/%.2lq/%.2lq", adc_app_ch_num(i),
+                 ss.min, ss.max, mean_x100, sd_x100);
+    }
+}
+
+static void emit_temp(void)
+{
+    int idx = adc_app_ch_find(ADC_NTC_CHANNEL);
+    uint16_t raw;
+
+    if (idx < 0 || !adc_app_snapshot_mean((uint8_t)idx, 16, &raw)) {
+        line_add(" off");
+        return;
+    }
+
+    int16_t cc = ntc_code_to_centi_c(raw);
+
+    if (cc == NTC_INVALID)
+        line_add(" err");
+    else
+        line_add(" %.2q", cc);
+}
+
+static const watch_metric_t metrics[] = {
+    { "adc.avg",    emit_avg },
+    { "adc.latest", emit_latest },
+    { "adc.stats",  emit_stats },
+    { "adc.temp",   emit_temp },
+    { "adc.volts",  emit_volts },
+};
+
+#define METRIC_COUNT ((uint8_t)(sizeof(metrics) / sizeof(metrics[0])))
+
+static const watch_metric_t *metric_find(const char *name)
+{
+    for (uint8_t i = 0; i < METRIC_COUNT; i++)
+        if (strcmp(metrics[i].name, name) == 0)
+            return &metrics[i];
+    return NULL;
+}
+
+int watch_add(const char *metric, uint32_t period_ms)
+{
+    const watch_metric_t *m = metric_find(metric);
+    watch_slot_t *free_slot = NULL;
+
+    if (m == NULL)
+        return WATCH_ERR_METRIC;
+    if (period_ms < WATCH_MIN_PERIOD_MS || period_ms > WATCH_MAX_PERIOD_MS)
+        return WATCH_ERR_PERIOD;
+
+    for (uint8_t i = 0; i < WATCH_SLOTS; i++) {
+        if (slots[i].m == m) {
+            free_slot = &slots[i];          // re-time the existing one
+            break;
+        }
+        if (slots[i].m == NULL && free_slot == NULL)
+            free_slot = &slots[i];
+    }
+
+    if (free_slot == NULL)
+        return WATCH_ERR_FULL;
+
+    free_slot->m = m;
+    free_slot->period_ms = period_ms;
+    free_slot->next_ms = system_uptime_ms();    // first line on the next poll
+    free_slot->late = 0;
+    return 0;
+}
+
+uint8_t watch_remove(const char *metric)
+{
+    uint8_t n = 0;
+
+    for (uint8_t i = 0; i < WATCH_SLOTS; i++) {
+        if (slots[i].m && (metric == NULL || strcmp(slots[i].m->name, metric) == 0)) {
+            slots[i].m = NULL;
+            n++;
+        }
+    }
+    return n;
+}
+
+void watch_poll(uint32_t now_ms)
+{
+    for (uint8_t i = 0; i < WATCH_SLOTS; i++) {
+        watch_slot_t *s = &slots[i];
+
+        if (s->m == NULL || (int32_t)(now_ms - s->next_ms) < 0)
+            continue;
+
+        line_len = 0;
+        line_add("@%s %lu", s->m->name, now_ms);
+        s->m->emit();
+        console_printf("%s\r\n", line);
+
+        /* keep the phase; if we fell a whole period behind, skip ahead */
+        s->next_ms += s->period_ms;
+        if ((int32_t)(now_ms - s->next_ms) >= 0) {
+            uint32_t missed = (now_ms - s->next_ms) / s->period_ms + 1;
+
+            s->late += missed;
+            s->next_ms += missed * s->period_ms;
+        }
+    }
+}
+
+int watch_next_due(uint32_t *due_ms)
+{
+    int found = -1;
+
+    for (uint8_t i = 0; i < WATCH_SLOTS; i++) {
+        if (slots[i].m == NULL)
+            continue;
+        if (found != 0 || (int32_t)(slots[i].next_ms - *due_ms) < 0)
+            *due_ms = slots[i].next_ms;
+        found = 0;
+    }
+    return found;
+}
+
+/* listing walks the active slots in order */
+static watch_slot_t *slot_at(uint8_t i)
+{
+    for (uint8_t k = 0; k < WATCH_SLOTS; k++) {
+        if (slots[k].m == NULL)
+            continue;
+        if (i-- == 0)
+            return &slots[k];
+    }
+    return NULL;
+}
+
+uint8_t watch_count(void)
+{
+    uint8_t n = 0;
+
+    for (uint8_t i = 0; i < WATCH_SLOTS; i++)
+        if (slots[i].m)
+            n++;
+    return n;
+}
+
+const char *watch_name(uint8_t i)
+{
+    watch_slot_t *s = slot_at(i);
+    return s ? s->m->name : "";
+}
+
+uint32_t watch_period(uint8_t i)
+{
+    watch_slot_t *s = slot_at(i);
+    return s ? s->period_ms : 0;
+}
+
+uint32_t watch_late(uint8_t i)
+{
+    watch_slot_t *s = slot_at(i);
+    return s ? s->late : 0;
+}
+
+uint8_t watch_metric_count(void)
+{
+    return METRIC_COUNT;
+}
+
+const char *watch_metric_name(uint8_t i)
+{
+    return i < METRIC_COUNT ? metrics[i].name : "";
+}
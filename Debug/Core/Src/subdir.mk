@@ -7,47 +7,83 @@
 C_SRCS += \
 ../Core/Src/adc.c \
 ../Core/Src/adc_app.c \
+../Core/Src/adc_conv.c \
+../Core/Src/adc_history.c \
+../Core/Src/adc_os.c \
+../Core/Src/adc_rice.c \
+../Core/Src/adc_ring.c \
+../Core/Src/adc_stream.c \
 ../Core/Src/console.c \
+../Core/Src/defer.c \
 ../Core/Src/dma.c \
+../Core/Src/fmt.c \
 ../Core/Src/gpio.c \
 ../Core/Src/main.c \
+../Core/Src/ntc.c \
+../Core/Src/ntc_table.c \
 ../Core/Src/stm32f4xx_hal_msp.c \
 ../Core/Src/stm32f4xx_it.c \
 ../Core/Src/syscalls.c \
 ../Core/Src/sysmem.c \
 ../Core/Src/system_stm32f4xx.c \
 ../Core/Src/tim.c \
-../Core/Src/usart.c 
+../Core/Src/timebase.c \
+../Core/Src/usart.c \
+../Core/Src/watch.c 
 
 OBJS += \
 ./Core/Src/adc.o \
 ./Core/Src/adc_app.o \
+./Core/Src/adc_conv.o \
+./Core/Src/adc_history.o \
+./Core/Src/adc_os.o \
+./Core/Src/adc_rice.o \
+./Core/Src/adc_ring.o \
+./Core/Src/adc_stream.o \
 ./Core/Src/console.o \
+./Core/Src/defer.o \
 ./Core/Src/dma.o \
+./Core/Src/fmt.o \
 ./Core/Src/gpio.o \
 ./Core/Src/main.o \
+./Core/Src/ntc.o \
+./Core/Src/ntc_table.o \
 ./Core/Src/stm32f4xx_hal_msp.o \
 ./Core/Src/stm32f4xx_it.o \
 ./Core/Src/syscalls.o \
 ./Core/Src/sysmem.o \
 ./Core/Src/system_stm32f4xx.o \
 ./Core/Src/tim.o \
-./Core/Src/usart.o 
+./Core/Src/timebase.o \
+./Core/Src/usart.o \
+./Core/Src/watch.o 
 
 C_DEPS += \
 ./Core/Src/adc.d \
 ./Core/Src/adc_app.d \
+./Core/Src/adc_conv.d \
+./Core/Src/adc_history.d \
+./Core/Src/adc_os.d \
+./Core/Src/adc_rice.d \
+./Core/Src/adc_ring.d \
+./Core/Src/adc_stream.d \
 ./Core/Src/console.d \
+./Core/Src/defer.d \
 ./Core/Src/dma.d \
+./Core/Src/fmt.d \
 ./Core/Src/gpio.d \
 ./Core/Src/main.d \
+./Core/Src/ntc.d \
+./Core/Src/ntc_table.d \
 ./Core/Src/stm32f4xx_hal_msp.d \
 ./Core/Src/stm32f4xx_it.d \
 ./Core/Src/syscalls.d \
 ./Core/Src/sysmem.d \
 ./Core/Src/system_stm32f4xx.d \
 ./Core/Src/tim.d \
-./Core/Src/usart.d 
+./Core/Src/timebase.d \
+./Core/Src/usart.d \
+./Core/Src/watch.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -57,7 +93,7 @@ Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/adc.cyclo ./Core/Src/adc.d ./Core/Src/adc.o ./Core/Src/adc.su ./Core/Src/adc_app.cyclo ./Core/Src/adc_app.d ./Core/Src/adc_app.o ./Core/Src/adc_app.su ./Core/Src/console.cyclo ./Core/Src/console.d ./Core/Src/console.o ./Core/Src/console.su ./Core/Src/dma.cyclo ./Core/Src/dma.d ./Core/Src/dma.o ./Core/Src/dma.su ./Core/Src/gpio.cyclo ./Core/Src/gpio.d ./Core/Src/gpio.o ./Core/Src/gpio.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/stm32f4xx_hal_msp.cyclo ./Core/Src/stm32f4xx_hal_msp.d ./Core/Src/stm32f4xx_hal_msp.o ./Core/Src/stm32f4xx_hal_msp.su ./Core/Src/stm32f4xx_it.cyclo ./Core/Src/stm32f4xx_it.d ./Core/Src/stm32f4xx_it.o ./Core/Src/stm32f4xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f4xx.cyclo ./Core/Src/system_stm32f4xx.d ./Core/Src/system_stm32f4xx.o ./Core/Src/system_stm32f4xx.su ./Core/Src/tim.cyclo ./Core/Src/tim.d ./Core/Src/tim.o ./Core/Src/tim.su ./Core/Src/usart.cyclo ./Core/Src/usart.d ./Core/Src/usart.o ./Core/Src/usart.su
+	-$(RM) ./Core/Src/adc.cyclo ./Core/Src/adc.d ./Core/Src/adc.o ./Core/Src/adc.su ./Core/Src/adc_app.cyclo ./Core/Src/adc_app.d ./Core/Src/adc_app.o ./Core/Src/adc_app.su ./Core/Src/adc_conv.cyclo ./Core/Src/adc_conv.d ./Core/Src/adc_conv.o ./Core/Src/adc_conv.su ./Core/Src/adc_history.cyclo ./Core/Src/adc_history.d ./Core/Src/adc_history.o ./Core/Src/adc_history.su ./Core/Src/adc_os.cyclo ./Core/Src/adc_os.d ./Core/Src/adc_os.o ./Core/Src/adc_os.su ./Core/Src/adc_rice.cyclo ./Core/Src/adc_rice.d ./Core/Src/adc_rice.o ./Core/Src/adc_rice.su ./Core/Src/adc_ring.cyclo ./Core/Src/adc_ring.d ./Core/Src/adc_ring.o ./Core/Src/adc_ring.su ./Core/Src/adc_stream.cyclo ./Core/Src/adc_stream.d ./Core/Src/adc_stream.o ./Core/Src/adc_stream.su ./Core/Src/console.cyclo ./Core/Src/console.d ./Core/Src/console.o ./Core/Src/console.su ./Core/Src/defer.cyclo ./Core/Src/defer.d ./Core/Src/defer.o ./Core/Src/defer.su ./Core/Src/dma.cyclo ./Core/Src/dma.d ./Core/Src/dma.o ./Core/Src/dma.su ./Core/Src/fmt.cyclo ./Core/Src/fmt.d ./Core/Src/fmt.o ./Core/Src/fmt.su ./Core/Src/gpio.cyclo ./Core/Src/gpio.d ./Core/Src/gpio.o ./Core/Src/gpio.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/ntc.cyclo ./Core/Src/ntc.d ./Core/Src/ntc.o ./Core/Src/ntc.su ./Core/Src/ntc_table.cyclo ./Core/Src/ntc_table.d ./Core/Src/ntc_table.o ./Core/Src/ntc_table.su ./Core/Src/stm32f4xx_hal_msp.cyclo ./Core/Src/stm32f4xx_hal_msp.d ./Core/Src/stm32f4xx_hal_msp.o ./Core/Src/stm32f4xx_hal_msp.su ./Core/Src/stm32f4xx_it.cyclo ./Core/Src/stm32f4xx_it.d ./Core/Src/stm32f4xx_it.o ./Core/Src/stm32f4xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f4xx.cyclo ./Core/Src/system_stm32f4xx.d ./Core/Src/system_stm32f4xx.o ./Core/Src/system_stm32f4xx.su ./Core/Src/tim.cyclo ./Core/Src/tim.d ./Core/Src/tim.o ./Core/Src/tim.su ./Core/Src/timebase.cyclo ./Core/Src/timebase.d ./Core/Src/timebase.o ./Core/Src/timebase.su ./Core/Src/usart.cyclo ./Core/Src/usart.d ./Core/Src/usart.o ./Core/Src/usart.su ./Core/Src/watch.cyclo ./Core/Src/watch.d ./Core/Src/watch.o ./Core/Src/watch.su
 
 .PHONY: clean-Core-2f-Src
 
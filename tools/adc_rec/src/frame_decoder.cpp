@@ -0,0 +1,162 @@
+#include "frame_decoder.hpp"
+#include "rice_decoder.hpp"
+
+#include <cstring>
+
+namespace adcrec {
+
+namespace {
+
+constexpr size_t kMaxRaw = ADC_STREAM_HDR_SIZE + ADC_STREAM_MAX_CH * 1024 * 2 + 2;
+constexpr size_t kMaxEnc = kMaxRaw + kMaxRaw / 254 + 2;
+
+// returns false on malformed input
+bool cobs_decode(const std::vector<uint8_t> &in, std::vector<uint8_t> &out)
+{
+    out.clear();
+    size_t i = 0;
+
+    while (i < in.size()) {
+        uint8_t code = in[i++];
+        if (code == 0 || i + code - 1 > in.size())
+            return false;
+
+        out.insert(out.end(), in.begin() + i, in.begin() + i + code - 1);
+        i += code - 1;
+
+        if (code != 0xFF && i < in.size())
+            out.push_back(0);
+    }
+    return true;
+}
+
+template <typename T>
+T load_le(const uint8_t *p)
+{
+    T v = 0;
+    for (size_t i = 0; i < sizeof(T); i++)
+        v |= static_cast<T>(static_cast<T>(p[i]) << (8 * i));
+    return v;
+}
+
+} // namespace
+
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t *p, size_t n)
+{
+    static uint16_t table[256];
+    static bool ready = false;
+
+    if (!ready) {
+        for (unsigned i = 0; i < 256; i++) {
+            uint16_t c = static_cast<uint16_t>(i << 8);
+            for (int b = 0; b < 8; b++)
+                c = (c & 0x8000) ? static_cast<uint16_t>((c << 1) ^ ADC_STREAM_CRC_POLY)
+                                 : static_cast<uint16_t>(c << 1);
+            table[i] = c;
+        }
+        ready = true;
+    }
+
+    while (n--)
+        crc = static_cast<uint16_t>((crc << 8) ^ table[((crc >> 8) ^ *p++) & 0xFF]);
+    return crc;
+}
+
+FrameDecoder::FrameDecoder(Handler h) : handler_(std::move(h))
+{
+    enc_.reserve(kMaxEnc);
+    dec_.reserve(kMaxRaw);
+}
+
+void FrameDecoder::feed(const uint8_t *data, size_t n)
+{
+    stats_.bytes += n;
+
+    for (size_t i = 0; i < n; i++) {
+        if (data[i] == 0) {
+            finish_frame();
+            continue;
+        }
+
+        if (enc_.size() < kMaxEnc)
+            enc_.push_back(data[i]);
+        else
+            overflow_ = true;
+    }
+}
+
+void FrameDecoder::finish_frame()
+{
+    // every packet is preceded by its own delimiter, so empty frames are normal
+    if (enc_.empty() && !overflow_)
+        return;
+
+    bool overflow = overflow_;
+    overflow_ = false;
+
+    if (overflow) {
+        stats_.framing_errors++;
+        enc_.clear();
+        return;
+    }
+
+    if (!cobs_decode(enc_, dec_) || dec_.size() < ADC_STREAM_HDR_SIZE + 2) {
+        // console text between packets lands here too; only count it as
+        // an error if it looks like the start of a packet
+        if (!enc_.empty() && enc_.size() > 1 && enc_[1] == ADC_STREAM_MAGIC)
+            stats_.framing_errors++;
+        else
+            stats_.idle_frames++;
+        enc_.clear();
+        return;
+    }
+    enc_.clear();
+
+    const size_t body = dec_.size() - 2;
+    uint16_t want = load_le<uint16_t>(&dec_[body]);
+
+    if (crc16_ccitt(ADC_STREAM_CRC_INIT, dec_.data(), body) != want) {
+        if (dec_[0] == ADC_STREAM_MAGIC)
+            stats_.crc_errors++;
+        else
+            stats_.idle_frames++;
+        return;
+    }
+
+    Packet pkt;
+    std::memcpy(&pkt.hdr, dec_.data(), sizeof(pkt.hdr));   // wire and host are both LE
+
+    const size_t nsamp = static_cast<size_t>(pkt.hdr.nch) * pkt.hdr.frames;
+    const bool rice = pkt.hdr.flags & ADC_STREAM_F_RICE;
+
+    if (pkt.hdr.magic != ADC_STREAM_MAGIC || pkt.hdr.version != ADC_STREAM_VERSION ||
+        pkt.hdr.nch == 0 || pkt.hdr.nch > ADC_STREAM_MAX_CH ||
+        (!rice && body != ADC_STREAM_HDR_SIZE + nsamp * 2)) {
+        stats_.header_errors++;
+        return;
+    }
+
+    samples_.resize(nsamp);
+    if (rice) {
+        if (!rice_decode(&dec_[ADC_STREAM_HDR_SIZE], body - ADC_STREAM_HDR_SIZE,
+                         pkt.hdr.nch, pkt.hdr.frames, samples_.data())) {
+            stats_.header_errors++;
+            return;
+        }
+        pkt.hdr.flags &= static_cast<uint8_t>(~ADC_STREAM_F_RICE);   // samples are now raw
+    } else {
+        for (size_t i = 0; i < nsamp; i++)
+            samples_[i] = load_le<uint16_t>(&dec_[ADC_STREAM_HDR_SIZE + 2 * i]);
+    }
+
+    stats_.raw_payload += nsamp * 2;
+    stats_.wire_payload += body - ADC_STREAM_HDR_SIZE;
+
+    pkt.samples = samples_.data();
+    pkt.nsamples = nsamp;
+
+    stats_.packets++;
+    handler_(pkt);
+}
+
+} // namespace adcrec
@@ -0,0 +1,55 @@
+// Splits a byte stream into 0x00-delimited COBS frames and validates
+// them as adc_stream packets (see Core/Inc/adc_stream_proto.h).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+extern "C" {
+#include "adc_stream_proto.h"
+}
+
+namespace adcrec {
+
+struct Packet {
+    adc_stream_hdr_t hdr;
+    const uint16_t *samples;      // planar, hdr.nch * hdr.frames values
+    size_t nsamples;
+};
+
+struct DecodeStats {
+    uint64_t bytes = 0;
+    uint64_t packets = 0;
+    uint64_t crc_errors = 0;
+    uint64_t framing_errors = 0;  // bad COBS, oversize, or too short
+    uint64_t header_errors = 0;   // magic/version/length mismatch, bad Rice data
+    uint64_t idle_frames = 0;     // non-binary runs (console text) skipped
+    uint64_t raw_payload = 0;     // sample bytes after decompression
+    uint64_t wire_payload = 0;    // sample bytes as received
+};
+
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t *p, size_t n);
+
+class FrameDecoder {
+public:
+    using Handler = std::function<void(const Packet &)>;
+
+    explicit FrameDecoder(Handler h);
+
+    void feed(const uint8_t *data, size_t n);
+    const DecodeStats &stats() const { return stats_; }
+
+private:
+    void finish_frame();
+
+    Handler handler_;
+    DecodeStats stats_;
+    std::vector<uint8_t> enc_;
+    std::vector<uint8_t> dec_;
+    std::vector<uint16_t> samples_;
+    bool overflow_ = false;
+};
+
+} // namespace adcrec
@@ -0,0 +1,341 @@
+// adc_rec: record, inspect and export the firmware's "adc stream" output.
+//
+//   adc_rec record <tty|file|-> [-o out.adcr] [-b baud] [-B new_baud] [-t seconds]
+//   adc_rec info   <file.adcr>
+//   adc_rec dump   <file.adcr> [-r run] [-s start_s] [-d seconds]
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "frame_decoder.hpp"
+#include "recording.hpp"
+#include "serial_port.hpp"
+
+using namespace adcrec;
+
+namespace {
+
+volatile std::sig_atomic_t g_stop = 0;
+
+void on_signal(int)
+{
+    g_stop = 1;
+}
+
+void usage()
+{
+    std::fprintf(stderr,
+        "usage:\n"
+        "  adc_rec record <tty|file|-> [-o out.adcr] [-b baud] [-B new_baud] [-t seconds]\n"
+        "  adc_rec info   <file.adcr>\n"
+        "  adc_rec dump   <file.adcr> [-r run] [-s start_s] [-d seconds]\n");
+}
+
+// loss and throughput as seen from the packet headers
+struct LinkStats {
+    bool have_last = false;
+    uint16_t run = 0;
+    uint32_t seq = 0;
+    uint64_t lost_blocks = 0;
+    uint64_t run_changes = 0;
+    uint64_t samples = 0;
+    double nominal_sps = 0;       // rate * nch of the latest packet
+
+    void update(const Packet &p)
+    {
+        if (have_last && p.hdr.run == run && p.hdr.seq > seq)
+            lost_blocks += p.hdr.seq - seq - 1;
+        else if (have_last && (p.hdr.run != run || p.hdr.seq <= seq))
+            run_changes++;
+
+        have_last = true;
+        run = p.hdr.run;
+        seq = p.hdr.seq;
+        samples += p.nsamples;
+        nominal_sps = p.hdr.rate_mhz / 1000.0 * p.hdr.nch;
+    }
+};
+
+void print_status(const char *tag, double elapsed, double sps, const LinkStats &ls,
+                  const DecodeStats &ds)
+{
+    std::fprintf(stderr,
+        "%s t=%.0fs pkts=%llu sps=%.0f (nominal %.0f) lost=%llu runs=%llu "
+        "crc=%llu framing=%llu hdr=%llu ratio=%.2f\n",
+        tag, elapsed, (unsigned long long)ds.packets, sps, ls.nominal_sps,
+        (unsigned long long)ls.lost_blocks, (unsigned long long)ls.run_changes,
+        (unsigned long long)ds.crc_errors, (unsigned long long)ds.framing_errors,
+        (unsigned long long)ds.header_errors,
+        ds.wire_payload ? (double)ds.raw_payload / ds.wire_payload : 1.0);
+}
+
+// read until `text` shows up; binary stream frames may be interleaved
+bool wait_for(SerialPort &port, const std::string &text, int timeout_ms)
+{
+    using clock = std::chrono::steady_clock;
+    const auto deadline = clock::now() + std::chrono::milliseconds(timeout_ms);
+    std::string seen;
+    uint8_t buf[256];
+
+    while (clock::now() < deadline) {
+        long n = port.read(buf, sizeof(buf), 50);
+        if (n < 0)
+            return false;
+        seen.append(reinterpret_cast<const char *>(buf), static_cast<size_t>(n));
+        if (seen.find(text) != std::string::npos)
+            return true;
+    }
+    return false;
+}
+
+// Firmware "baud <rate>": it announces at the old rate, switches once its
+// TX has drained and reverts unless "baud ok" arrives at the new rate.
+void negotiate_baud(SerialPort &port, unsigned from, unsigned to)
+{
+    const std::string rate = std::to_string(to);
+    const std::string cmd = "\rbaud " + rate + "\r";
+
+    port.write(cmd.data(), cmd.size());
+    if (!wait_for(port, "send \"baud ok\"", 1000))
+        throw std::runtime_error("firmware refused baud " + rate);
+
+    port.set_baud(to);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // leading CR flushes any junk the firmware saw during the switch
+    const std::string ack = "\rbaud ok\r";
+    for (int tries = 0; tries < 3; tries++) {
+        port.write(ack.data(), ack.size());
+        if (wait_for(port, "baud " + rate + " ok", 300)) {
+            std::fprintf(stderr, "link now %u baud\n", to);
+            return;
+        }
+    }
+
+    port.set_baud(from);
+    throw std::runtime_error("baud " + rate + " not acknowledged");
+}
+
+int cmd_record(int argc, char **argv)
+{
+    if (argc < 3) {
+        usage();
+        return 2;
+    }
+
+    std::string in = argv[2];
+    std::string out;
+    unsigned baud = 115200;
+    unsigned new_baud = 0;
+    double limit_s = 0;
+
+    for (int i = 3; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "-o"))
+            out = argv[i + 1];
+        else if (!std::strcmp(argv[i], "-b"))
+            baud = static_cast<unsigned>(std::strtoul(argv[i + 1], nullptr, 10));
+        else if (!std::strcmp(argv[i], "-B"))
+            new_baud = static_cast<unsigned>(std::strtoul(argv[i + 1], nullptr, 10));
+        else if (!std::strcmp(argv[i], "-t"))
+            limit_s = std::strtod(argv[i + 1], nullptr);
+        else {
+            usage();
+            return 2;
+        }
+    }
+
+    SerialPort port(in, baud);
+    if (new_baud && new_baud != baud) {
+        if (!port.is_tty())
+            throw std::runtime_error("-B needs a tty");
+        negotiate_baud(port, baud, new_baud);
+    }
+
+    std::unique_ptr<RecordingWriter> writer;
+    if (!out.empty())
+        writer = std::make_unique<RecordingWriter>(out);
+
+    LinkStats ls;
+    FrameDecoder dec([&](const Packet &p) {
+        ls.update(p);
+        if (writer)
+            writer->append(p);
+    });
+
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    auto last_report = start;
+    uint64_t last_samples = 0;
+    uint8_t buf[4096];
+
+    while (!g_stop) {
+        long n = port.read(buf, sizeof(buf), 200);
+        if (n < 0)
+            break;
+        dec.feed(buf, static_cast<size_t>(n));
+
+        auto now = clock::now();
+        double elapsed = std::chrono::duration<double>(now - start).count();
+        double since = std::chrono::duration<double>(now - last_report).count();
+
+        if (since >= 1.0) {
+            double sps = (ls.samples - last_samples) / since;
+            print_status("rec", elapsed, sps, ls, dec.stats());
+            last_samples = ls.samples;
+            last_report = now;
+            if (writer)
+                writer->flush();
+        }
+
+        if (limit_s > 0 && elapsed >= limit_s)
+            break;
+    }
+
+    double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+    print_status("total", elapsed, elapsed > 0 ? ls.samples / elapsed : 0, ls, dec.stats());
+
+    if (writer) {
+        writer->close();
+        std::fprintf(stderr, "wrote %llu blocks to %s\n",
+                     (unsigned long long)writer->blocks(), out.c_str());
+    }
+    return 0;
+}
+
+int cmd_info(int argc, char **argv)
+{
+    if (argc < 3) {
+        usage();
+        return 2;
+    }
+
+    RecordingReader rec(argv[2]);
+    std::printf("%zu blocks%s\n", rec.size(),
+                rec.index_rebuilt() ? " (index rebuilt: recorder did not close)" : "");
+
+    // one line per contiguous run segment
+    size_t i = 0;
+    while (i < rec.size()) {
+        const IndexEntry &first = rec.entry(i);
+        uint64_t lost = 0;
+        size_t j = i + 1;
+
+        while (j < rec.size() && rec.entry(j).run == first.run &&
+               rec.entry(j).seq > rec.entry(j - 1).seq) {
+            lost += rec.entry(j).seq - rec.entry(j - 1).seq - 1;
+            j++;
+        }
+
+        const IndexEntry &last = rec.entry(j - 1);
+        const adc_stream_hdr_t &h = rec.header(i);
+        double t_end = rec.time_of(j - 1) + (last.rate_mhz ? last.frames / (last.rate_mhz / 1000.0) : 0);
+
+        std::printf("run %u: blocks=%zu seq=%u..%u lost=%llu t=%.3f..%.3fs rate=%.3fHz ch=",
+                    first.run, j - i, first.seq, last.seq, (unsigned long long)lost,
+                    rec.time_of(i), t_end, first.rate_mhz / 1000.0);
+        for (uint8_t c = 0; c < h.nch; c++)
+            std::printf("%s%u", c ? "," : "", h.chan[c]);
+        std::printf("\n");
+
+        i = j;
+    }
+    return 0;
+}
+
+int cmd_dump(int argc, char **argv)
+{
+    if (argc < 3) {
+        usage();
+        return 2;
+    }
+
+    long run = -1;
+    double start_s = 0;
+    double dur_s = -1;
+
+    for (int i = 3; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "-r"))
+            run = std::strtol(argv[i + 1], nullptr, 10);
+        else if (!std::strcmp(argv[i], "-s"))
+            start_s = std::strtod(argv[i + 1], nullptr);
+        else if (!std::strcmp(argv[i], "-d"))
+            dur_s = std::strtod(argv[i + 1], nullptr);
+        else {
+            usage();
+            return 2;
+        }
+    }
+
+    RecordingReader rec(argv[2]);
+    if (rec.size() == 0)
+        return 0;
+
+    uint16_t r = run < 0 ? rec.entry(0).run : static_cast<uint16_t>(run);
+    size_t b = rec.seek(r, start_s);
+    if (b >= rec.size() || rec.entry(b).run != r) {
+        std::fprintf(stderr, "run %u not in recording\n", r);
+        return 1;
+    }
+
+    const adc_stream_hdr_t &h0 = rec.header(b);
+    std::printf("time_s");
+    for (uint8_t c = 0; c < h0.nch; c++)
+        std::printf(",ch%u", h0.chan[c]);
+    std::printf("\n");
+
+    for (; b < rec.size() && rec.entry(b).run == r; b++) {
+        const IndexEntry &e = rec.entry(b);
+        const uint16_t *s = rec.samples(b);
+        double dt = e.rate_mhz ? 1000.0 / e.rate_mhz : 0;
+
+        for (uint16_t f = 0; f < e.frames; f++) {
+            double t = rec.time_of(b) + f * dt;
+            if (t < start_s)
+                continue;
+            if (dur_s >= 0 && t >= start_s + dur_s)
+                return 0;
+
+            std::printf("%.6f", t);
+            for (uint8_t c = 0; c < e.nch; c++)
+                std::printf(",%u", s[c * e.frames + f]);
+            std::printf("\n");
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        usage();
+        return 2;
+    }
+
+    try {
+        if (!std::strcmp(argv[1], "record"))
+            return cmd_record(argc, argv);
+        if (!std::strcmp(argv[1], "info"))
+            return cmd_info(argc, argv);
+        if (!std::strcmp(argv[1], "dump"))
+            return cmd_dump(argc, argv);
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "adc_rec: %s\n", e.what());
+        return 1;
+    }
+
+    usage();
+    return 2;
+}
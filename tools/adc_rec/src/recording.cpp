@@ -0,0 +1,209 @@
+#include "recording.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace adcrec {
+
+namespace {
+
+constexpr char kMagic[8] = {'A', 'D', 'C', 'R', 'E', 'C', '1', '\0'};
+constexpr uint32_t kVersion = 1;
+
+size_t record_size(const adc_stream_hdr_t &h)
+{
+    size_t n = ADC_STREAM_HDR_SIZE + static_cast<size_t>(h.nch) * h.frames * 2;
+    return (n + 7) & ~static_cast<size_t>(7);
+}
+
+IndexEntry make_entry(uint64_t offset, const adc_stream_hdr_t &h)
+{
+    IndexEntry e{};
+    e.offset = offset;
+    e.t0 = h.t0;
+    e.seq = h.seq;
+    e.rate_mhz = h.rate_mhz;
+    e.run = h.run;
+    e.nch = h.nch;
+    e.flags = h.flags;
+    e.frames = h.frames;
+    return e;
+}
+
+} // namespace
+
+RecordingWriter::RecordingWriter(const std::string &path)
+{
+    f_ = std::fopen(path.c_str(), "wb");
+    if (!f_)
+        throw std::runtime_error("cannot create " + path);
+
+    std::memcpy(fh_.magic, kMagic, sizeof(kMagic));
+    fh_.version = kVersion;
+    fh_.header_size = sizeof(FileHeader);
+    fh_.data_offset = sizeof(FileHeader);
+    fh_.created_unix_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    std::fwrite(&fh_, sizeof(fh_), 1, f_);
+    pos_ = sizeof(fh_);
+}
+
+RecordingWriter::~RecordingWriter()
+{
+    close();
+}
+
+void RecordingWriter::append(const Packet &pkt)
+{
+    static const uint8_t pad[8] = {};
+    const size_t payload = pkt.nsamples * 2;
+    const size_t total = record_size(pkt.hdr);
+
+    index_.push_back(make_entry(pos_, pkt.hdr));
+
+    std::fwrite(&pkt.hdr, ADC_STREAM_HDR_SIZE, 1, f_);
+    std::fwrite(pkt.samples, 2, pkt.nsamples, f_);
+    std::fwrite(pad, 1, total - ADC_STREAM_HDR_SIZE - payload, f_);
+    pos_ += total;
+}
+
+void RecordingWriter::flush()
+{
+    if (f_)
+        std::fflush(f_);
+}
+
+void RecordingWriter::close()
+{
+    if (!f_)
+        return;
+
+    const uint64_t index_offset = pos_;
+    if (!index_.empty())
+        std::fwrite(index_.data(), sizeof(IndexEntry), index_.size(), f_);
+
+    fh_.index_offset = index_offset;
+    fh_.index_count = index_.size();
+
+    std::fseek(f_, 0, SEEK_SET);
+    std::fwrite(&fh_, sizeof(fh_), 1, f_);
+    std::fclose(f_);
+    f_ = nullptr;
+}
+
+RecordingReader::RecordingReader(const std::string &path)
+{
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    if (fd_ < 0)
+        throw std::runtime_error("cannot open " + path);
+
+    struct stat st;
+    if (::fstat(fd_, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(FileHeader))
+        throw std::runtime_error(path + ": not a recording");
+
+    map_len_ = static_cast<size_t>(st.st_size);
+    void *m = ::mmap(nullptr, map_len_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (m == MAP_FAILED)
+        throw std::runtime_error("mmap failed for " + path);
+    map_ = static_cast<const uint8_t *>(m);
+
+    FileHeader fh;
+    std::memcpy(&fh, map_, sizeof(fh));
+    if (std::memcmp(fh.magic, kMagic, sizeof(kMagic)) != 0 || fh.version != kVersion)
+        throw std::runtime_error(path + ": not a recording");
+
+    if (fh.index_offset != 0 &&
+        fh.index_offset + fh.index_count * sizeof(IndexEntry) <= map_len_) {
+        index_ = reinterpret_cast<const IndexEntry *>(map_ + fh.index_offset);
+        count_ = fh.index_count;
+    } else {
+        rebuild_index();
+    }
+
+    // seconds from run start per block, following rate changes; a run
+    // already in progress when recording began starts at t0 / rate
+    times_.resize(count_);
+    for (size_t i = 0; i < count_; i++) {
+        const IndexEntry &e = index_[i];
+
+        if (i == 0 || index_[i - 1].run != e.run) {
+            times_[i] = e.rate_mhz ? e.t0 / (e.rate_mhz / 1000.0) : 0.0;
+            continue;
+        }
+
+        const IndexEntry &p = index_[i - 1];
+        times_[i] = times_[i - 1] + (p.rate_mhz ? (e.t0 - p.t0) / (p.rate_mhz / 1000.0) : 0.0);
+    }
+}
+
+RecordingReader::~RecordingReader()
+{
+    if (map_)
+        ::munmap(const_cast<uint8_t *>(map_), map_len_);
+    if (fd_ >= 0)
+        ::close(fd_);
+}
+
+void RecordingReader::rebuild_index()
+{
+    size_t pos = sizeof(FileHeader);
+
+    while (pos + ADC_STREAM_HDR_SIZE <= map_len_) {
+        adc_stream_hdr_t h;
+        std::memcpy(&h, map_ + pos, sizeof(h));
+
+        if (h.magic != ADC_STREAM_MAGIC || h.nch == 0 || h.nch > ADC_STREAM_MAX_CH)
+            break;
+
+        size_t len = record_size(h);
+        if (pos + len > map_len_)
+            break;                              // torn final record
+
+        owned_index_.push_back(make_entry(pos, h));
+        pos += len;
+    }
+
+    index_ = owned_index_.data();
+    count_ = owned_index_.size();
+    rebuilt_ = true;
+}
+
+const adc_stream_hdr_t &RecordingReader::header(size_t i) const
+{
+    return *reinterpret_cast<const adc_stream_hdr_t *>(map_ + index_[i].offset);
+}
+
+const uint16_t *RecordingReader::samples(size_t i) const
+{
+    return reinterpret_cast<const uint16_t *>(map_ + index_[i].offset + ADC_STREAM_HDR_SIZE);
+}
+
+size_t RecordingReader::seek(uint16_t run, double t) const
+{
+    size_t lo = 0;
+    while (lo < count_ && index_[lo].run != run)
+        lo++;
+
+    size_t hi = lo;
+    while (hi < count_ && index_[hi].run == run)
+        hi++;
+
+    // last block starting at or before t
+    auto first = times_.begin() + static_cast<std::ptrdiff_t>(lo);
+    auto last = times_.begin() + static_cast<std::ptrdiff_t>(hi);
+    auto it = std::upper_bound(first, last, t);
+
+    if (it != first)
+        --it;
+    return static_cast<size_t>(it - times_.begin());
+}
+
+} // namespace adcrec
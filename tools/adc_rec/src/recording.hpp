@@ -0,0 +1,102 @@
+// .adcr recording file: validated packets laid out for mmap.
+//
+//   FileHeader (64 B)
+//   records:  adc_stream_hdr_t | planar uint16 samples | pad to 8 B
+//   IndexEntry[index_count]   (written on close)
+//
+// If the recorder dies before close, index_offset stays 0 and the reader
+// rebuilds the index by walking the self-describing records.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "frame_decoder.hpp"
+
+namespace adcrec {
+
+struct FileHeader {
+    char     magic[8];            // "ADCREC1"
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t index_offset;
+    uint64_t index_count;
+    uint64_t data_offset;
+    int64_t  created_unix_ns;
+    uint8_t  reserved[16];
+};
+static_assert(sizeof(FileHeader) == 64, "FileHeader layout");
+
+struct IndexEntry {
+    uint64_t offset;              // of the record's adc_stream_hdr_t
+    uint64_t t0;
+    uint32_t seq;
+    uint32_t rate_mhz;
+    uint16_t run;
+    uint8_t  nch;
+    uint8_t  flags;
+    uint16_t frames;
+    uint16_t reserved;
+};
+static_assert(sizeof(IndexEntry) == 32, "IndexEntry layout");
+
+class RecordingWriter {
+public:
+    explicit RecordingWriter(const std::string &path);
+    ~RecordingWriter();
+
+    RecordingWriter(const RecordingWriter &) = delete;
+    RecordingWriter &operator=(const RecordingWriter &) = delete;
+
+    void append(const Packet &pkt);
+    void flush();
+    void close();
+
+    uint64_t blocks() const { return index_.size(); }
+
+private:
+    std::FILE *f_ = nullptr;
+    FileHeader fh_{};
+    uint64_t pos_ = 0;
+    std::vector<IndexEntry> index_;
+};
+
+class RecordingReader {
+public:
+    explicit RecordingReader(const std::string &path);
+    ~RecordingReader();
+
+    RecordingReader(const RecordingReader &) = delete;
+    RecordingReader &operator=(const RecordingReader &) = delete;
+
+    size_t size() const { return count_; }
+    const IndexEntry &entry(size_t i) const { return index_[i]; }
+    const adc_stream_hdr_t &header(size_t i) const;
+    const uint16_t *samples(size_t i) const;     // planar, nch * frames
+
+    // seconds since the start of the entry's run; piecewise across rate changes
+    double time_of(size_t i) const { return times_[i]; }
+
+    // block of the first segment of `run` that covers t seconds (or the
+    // nearest end); run ids restart after a board reset
+    size_t seek(uint16_t run, double t) const;
+
+    bool index_rebuilt() const { return rebuilt_; }
+
+private:
+    void rebuild_index();
+
+    int fd_ = -1;
+    const uint8_t *map_ = nullptr;
+    size_t map_len_ = 0;
+    const IndexEntry *index_ = nullptr;
+    size_t count_ = 0;
+    std::vector<IndexEntry> owned_index_;
+    std::vector<double> times_;
+    bool rebuilt_ = false;
+};
+
+} // namespace adcrec
@@ -0,0 +1,108 @@
+#include "rice_decoder.hpp"
+
+extern "C" {
+#include "adc_stream_proto.h"
+}
+
+namespace adcrec {
+
+namespace {
+
+constexpr unsigned kRawBits = 12;
+
+class BitReader {
+public:
+    BitReader(const uint8_t *p, size_t len) : p_(p), len_(len) {}
+
+    bool get(unsigned n, uint32_t &v)
+    {
+        v = 0;
+        while (n--) {
+            if (pos_ >= len_ * 8)
+                return false;
+            v = (v << 1) | ((p_[pos_ >> 3] >> (7 - (pos_ & 7))) & 1u);
+            pos_++;
+        }
+        return true;
+    }
+
+    void align() { pos_ = (pos_ + 7) & ~static_cast<size_t>(7); }
+
+private:
+    const uint8_t *p_;
+    size_t len_;
+    size_t pos_ = 0;
+};
+
+} // namespace
+
+bool rice_decode(const uint8_t *in, size_t len, unsigned nch, unsigned frames, uint16_t *out)
+{
+    BitReader br(in, len);
+
+    for (unsigned c = 0; c < nch; c++) {
+        uint16_t *x = out + static_cast<size_t>(c) * frames;
+        uint32_t mode;
+
+        if (!br.get(8, mode))
+            return false;
+
+        unsigned order = mode >> 6;
+        unsigned k = mode & 0x0F;
+
+        if (order == ADC_RICE_MODE_VERBATIM) {
+            for (unsigned i = 0; i < frames; i++) {
+                uint32_t v;
+                if (!br.get(kRawBits, v))
+                    return false;
+                x[i] = static_cast<uint16_t>(v);
+            }
+            br.align();
+            continue;
+        }
+
+        for (unsigned i = 0; i < order && i < frames; i++) {
+            uint32_t v;
+            if (!br.get(kRawBits, v))
+                return false;
+            x[i] = static_cast<uint16_t>(v);
+        }
+
+        for (unsigned i = order; i < frames; i++) {
+            uint32_t q = 0, bit, u;
+
+            for (;;) {
+                if (!br.get(1, bit))
+                    return false;
+                if (!bit)
+                    break;
+                if (++q == ADC_RICE_QMAX)
+                    break;
+            }
+
+            if (q == ADC_RICE_QMAX) {
+                if (!br.get(ADC_RICE_ESC_BITS, u))
+                    return false;
+            } else {
+                uint32_t low = 0;
+                if (k && !br.get(k, low))
+                    return false;
+                u = (q << k) | low;
+            }
+
+            int32_t e = (u & 1) ? -static_cast<int32_t>((u + 1) >> 1) : static_cast<int32_t>(u >> 1);
+            int32_t pred = order == 0 ? 0
+                         : order == 1 ? x[i - 1]
+                         : 2 * static_cast<int32_t>(x[i - 1]) - x[i - 2];
+            int32_t v = pred + e;
+
+            if (v < 0 || v > 0xFFFF)
+                return false;
+            x[i] = static_cast<uint16_t>(v);
+        }
+        br.align();
+    }
+    return true;
+}
+
+} // namespace adcrec
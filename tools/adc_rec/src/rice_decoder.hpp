@@ -0,0 +1,13 @@
+// Decoder for ADC_STREAM_F_RICE payloads (see adc_stream_proto.h).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace adcrec {
+
+// decodes nch sections of `frames` samples each into planar `out`;
+// returns false on a malformed or short payload
+bool rice_decode(const uint8_t *in, size_t len, unsigned nch, unsigned frames, uint16_t *out);
+
+} // namespace adcrec
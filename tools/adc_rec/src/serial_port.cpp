@@ -0,0 +1,140 @@
+#include "serial_port.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace adcrec {
+
+namespace {
+
+speed_t baud_constant(unsigned baud)
+{
+    switch (baud) {
+    case 9600:    return B9600;
+    case 19200:   return B19200;
+    case 38400:   return B38400;
+    case 57600:   return B57600;
+    case 115200:  return B115200;
+    case 230400:  return B230400;
+    case 460800:  return B460800;
+    case 921600:  return B921600;
+    case 1000000: return B1000000;
+    case 1500000: return B1500000;
+    case 2000000: return B2000000;
+    case 2500000: return B2500000;
+    case 3000000: return B3000000;
+    case 3500000: return B3500000;
+    case 4000000: return B4000000;
+    default:
+        throw std::runtime_error("unsupported baud " + std::to_string(baud));
+    }
+}
+
+} // namespace
+
+SerialPort::SerialPort(const std::string &path, unsigned baud)
+{
+    if (path == "-") {
+        fd_ = STDIN_FILENO;
+        owned_ = false;
+        return;
+    }
+
+    // a tty is opened read/write for baud negotiation; captures may be read-only
+    fd_ = ::open(path.c_str(), O_RDWR | O_NOCTTY);
+    if (fd_ < 0)
+        fd_ = ::open(path.c_str(), O_RDONLY | O_NOCTTY);
+    if (fd_ < 0)
+        throw std::runtime_error("cannot open " + path + ": " + std::strerror(errno));
+
+    tty_ = ::isatty(fd_);
+    if (!tty_)
+        return;
+
+    termios tio;
+    if (::tcgetattr(fd_, &tio) != 0)
+        throw std::runtime_error("tcgetattr failed on " + path);
+
+    ::cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cflag &= ~(CSTOPB | CRTSCTS);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+
+    speed_t sp = baud_constant(baud);
+    ::cfsetispeed(&tio, sp);
+    ::cfsetospeed(&tio, sp);
+
+    if (::tcsetattr(fd_, TCSANOW, &tio) != 0)
+        throw std::runtime_error("tcsetattr failed on " + path);
+    ::tcflush(fd_, TCIFLUSH);
+}
+
+SerialPort::~SerialPort()
+{
+    if (owned_ && fd_ >= 0)
+        ::close(fd_);
+}
+
+long SerialPort::read(uint8_t *buf, size_t n, int timeout_ms)
+{
+    pollfd p{fd_, POLLIN, 0};
+
+    int r = ::poll(&p, 1, timeout_ms);
+    if (r < 0)
+        return errno == EINTR ? 0 : -1;
+    if (r == 0)
+        return 0;
+
+    ssize_t got = ::read(fd_, buf, n);
+    if (got < 0)
+        return errno == EINTR || errno == EAGAIN ? 0 : -1;
+    if (got == 0)
+        return tty_ ? 0 : -1;      // regular file / pipe: EOF
+    return got;
+}
+
+void SerialPort::write(const void *buf, size_t n)
+{
+    if (!tty_)
+        throw std::runtime_error("write needs a tty");
+
+    const uint8_t *p = static_cast<const uint8_t *>(buf);
+    while (n > 0) {
+        ssize_t w = ::write(fd_, p, n);
+        if (w < 0) {
+            if (errno == EINTR || errno == EAGAIN)
+                continue;
+            throw std::runtime_error(std::string("write failed: ") + std::strerror(errno));
+        }
+        p += w;
+        n -= static_cast<size_t>(w);
+    }
+    ::tcdrain(fd_);
+}
+
+void SerialPort::set_baud(unsigned baud)
+{
+    if (!tty_)
+        throw std::runtime_error("set_baud needs a tty");
+
+    termios tio;
+    if (::tcgetattr(fd_, &tio) != 0)
+        throw std::runtime_error("tcgetattr failed");
+
+    speed_t sp = baud_constant(baud);
+    ::cfsetispeed(&tio, sp);
+    ::cfsetospeed(&tio, sp);
+
+    if (::tcsetattr(fd_, TCSADRAIN, &tio) != 0)
+        throw std::runtime_error("tcsetattr failed");
+    ::tcflush(fd_, TCIFLUSH);
+}
+
+} // namespace adcrec
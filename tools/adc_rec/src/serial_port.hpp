@@ -0,0 +1,36 @@
+// Byte source for the recorder: a tty (configured raw at the given
+// baud), a regular file / fifo, or "-" for stdin.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace adcrec {
+
+class SerialPort {
+public:
+    SerialPort(const std::string &path, unsigned baud);
+    ~SerialPort();
+
+    SerialPort(const SerialPort &) = delete;
+    SerialPort &operator=(const SerialPort &) = delete;
+
+    // waits up to timeout_ms; returns bytes read, 0 on timeout, -1 at EOF
+    long read(uint8_t *buf, size_t n, int timeout_ms);
+
+    // tty only: returns once the bytes are on the wire
+    void write(const void *buf, size_t n);
+
+    // tty only: change speed after pending output has drained
+    void set_baud(unsigned baud);
+
+    bool is_tty() const { return tty_; }
+
+private:
+    int fd_ = -1;
+    bool tty_ = false;
+    bool owned_ = true;
+};
+
+} // namespace adcrec
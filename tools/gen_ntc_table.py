@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Generate Core/Src/ntc_table.c from the constants in Core/Inc/ntc.h.
+
+One int16 entry per 12-bit ADC code, in centi-degrees C, computed with the
+same beta equation as thermistor_beta_to_celsius() in adc_app.c. Prints the
+accuracy of the rounded table against the double-precision reference.
+
+usage: python3 tools/gen_ntc_table.py [--check]
+
+The Debug build runs this through makefile.targets whenever ntc.h or this
+script is newer than the table. --check writes nothing and exits 1 if the
+committed table differs from what the constants produce.
+"""
+
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HDR = os.path.join(ROOT, "Core", "Inc", "ntc.h")
+OUT = os.path.join(ROOT, "Core", "Src", "ntc_table.c")
+
+CODES = 4096
+INT16_MIN, INT16_MAX = -32768, 32767
+
+
+def read_constants():
+    consts = {}
+    with open(HDR) as f:
+        for line in f:
+            m = re.match(r"#define\s+(NTC_\w+)\s+(-?\d+)\b", line)
+            if m:
+                consts[m.group(1)] = int(m.group(2))
+    return consts
+
+
+def reference_c(code, c):
+    r_ntc = c["NTC_R_PULLUP_OHM"] * code / (CODES - 1 - code)
+    t0_k = c["NTC_T0_C"] + 273.15
+    temp_k = 1.0 / (1.0 / t0_k + math.log(r_ntc / c["NTC_R0_OHM"]) / c["NTC_BETA"])
+    return temp_k - 273.15
+
+
+def main():
+    c = read_constants()
+    table = []
+    max_err = 0.0
+    worst = 0
+
+    for code in range(CODES):
+        if code == 0 or code == CODES - 1:
+            table.append(INT16_MIN)
+            continue
+
+        ref = reference_c(code, c) * 100.0
+        val = max(INT16_MIN + 1, min(INT16_MAX, int(round(ref))))
+        table.append(val)
+
+        if INT16_MIN < ref < INT16_MAX and abs(val - ref) > max_err:
+            max_err = abs(val - ref)
+            worst = code
+
+    report = ("max |table - reference| = %.3f centi-degC (code %d)"
+              % (max_err, worst))
+
+    out = ["/*\n",
+           " * ntc_table.c\n",
+           " *\n",
+           " * GENERATED by tools/gen_ntc_table.py from Core/Inc/ntc.h - do not edit.\n",
+           " *\n",
+           " * R_PULLUP=%d  R0=%d  BETA=%d  T0=%d C\n"
+           % (c["NTC_R_PULLUP_OHM"], c["NTC_R0_OHM"], c["NTC_BETA"], c["NTC_T0_C"]),
+           " * %s\n" % report,
+           " */\n\n",
+           '#include "ntc.h"\n\n',
+           "const int16_t ntc_table[NTC_ADC_CODES] =\n{\n"]
+    for i in range(0, CODES, 8):
+        row = ", ".join("%6d" % v for v in table[i:i + 8])
+        out.append("    %s,   /* %4d */\n" % (row, i))
+    out.append("};\n")
+    text = "".join(out)
+
+    try:
+        with open(OUT, newline="\n") as f:
+            old = f.read()
+    except FileNotFoundError:
+        old = None
+
+    if "--check" in sys.argv[1:]:
+        if old != text:
+            print("%s is stale: run tools/gen_ntc_table.py" % os.path.relpath(OUT, ROOT),
+                  file=sys.stderr)
+            return 1
+        print("ntc_table.c up to date")
+        return 0
+
+    if old == text:
+        os.utime(OUT)       # newer than its inputs, so make stops asking
+    else:
+        with open(OUT, "w", newline="\n") as f:
+            f.write(text)
+
+    print(report)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())